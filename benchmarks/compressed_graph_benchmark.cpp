@@ -0,0 +1,135 @@
+/*
+ * COMPRESSED GRAPH BENCHMARK
+ *
+ * Memory use and traversal speed of CompressedGraph (common/compressed_graph.h, delta + varint)
+ * against CsrGraph, on graphs with shuffled ids and after reordering (common/graph_reorder.h).
+ *
+ * Graphs:
+ * - Road-like: 1000 x 1000 grid, 4 neighbors, weights 1..10
+ * - Social-like: 1M vertices with a skewed degree distribution, unweighted
+ *
+ * Traversals: bfs() and dfs() of common/search.h (NoTrace), which take either graph type
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <algorithm>
+#include "../common/csr_graph.h"
+#include "../common/compressed_graph.h"
+#include "../common/graph_reorder.h"
+#include "../common/search.h"
+using namespace std;
+
+/**
+ * Hop distance of every vertex after bfs() of common/search.h (-1 = unreachable)
+ */
+template <typename Graph>
+vector<int> bfsDistances(const Graph& graph, int start) {
+    SearchWorkspace& workspace = SearchWorkspace::forThread();
+    bfs(start, graph, -1, workspace);
+    vector<int> dist(graph.numVertices());
+    for (int v = 0; v < graph.numVertices(); v++) dist[v] = workspace.cost(v) == INT_MAX ? -1 : workspace.cost(v);
+    return dist;
+}
+
+/**
+ * Total weight of all edges (exercises the weight decoding)
+ */
+template <typename Graph>
+long long weightSum(const Graph& graph) {
+    long long sum = 0;
+    for (int v = 0; v < graph.numVertices(); v++) {
+        for (auto [neighbor, weight] : graph.edges(v)) sum += weight + (neighbor & 0);
+    }
+    return sum;
+}
+
+// Best-of-3 wall time of one call, in milliseconds
+template <typename Work>
+double timeMs(Work work) {
+    double best = 1e30;
+    for (int r = 0; r < 3; r++) {
+        auto start = chrono::steady_clock::now();
+        work();
+        best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000);
+    }
+    return best;
+}
+
+// Results are written here so the compiler cannot discard the calls
+volatile long long benchmarkSink;
+
+size_t csrBytes(const CsrGraph& graph) {
+    return (graph.numVertices() + 1 + graph.numEdges() * (graph.weighted() ? 2 : 1)) * sizeof(int);
+}
+
+/**
+ * Compress one graph, compare memory and traversal time
+ *
+ * @return number of mismatches between the two representations
+ */
+int runWorkload(const char* name, const CsrGraph& graph) {
+    CompressedGraph compressed = CompressedGraph::fromCsr(graph);
+
+    int mismatches = 0;
+    if (bfsDistances(graph, 0) != bfsDistances(compressed, 0)) mismatches++;
+    if (dfs(0, graph).expanded != dfs(0, compressed).expanded) mismatches++;
+    if (weightSum(graph) != weightSum(compressed)) mismatches++;
+
+    double csrMb = csrBytes(graph) / 1e6, compressedMb = compressed.memoryBytes() / 1e6;
+    cout << "  " << left << setw(24) << name << right << fixed << setprecision(1)
+         << setw(8) << csrMb << setw(8) << compressedMb << setw(7) << csrMb / compressedMb << "x"
+         << setw(10) << timeMs([&] { benchmarkSink = bfs(0, graph).expanded; })
+         << setw(10) << timeMs([&] { benchmarkSink = bfs(0, compressed).expanded; })
+         << setw(10) << timeMs([&] { benchmarkSink = dfs(0, graph).expanded; })
+         << setw(10) << timeMs([&] { benchmarkSink = dfs(0, compressed).expanded; }) << "\n";
+    return mismatches;
+}
+
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int n = side * side;
+    mt19937 rng(42);
+
+    vector<int> label(n);
+    for (int v = 0; v < n; v++) label[v] = v;
+    shuffle(label.begin(), label.end(), rng);
+
+    // Road-like grid with shuffled ids
+    vector<WeightedEdge> roads;
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            int cell = y * side + x;
+            if (x + 1 < side) roads.push_back({label[cell], label[cell + 1], 1 + (int)(rng() % 10)});
+            if (y + 1 < side) roads.push_back({label[cell], label[cell + side], 1 + (int)(rng() % 10)});
+        }
+    }
+    CsrGraph grid = CsrGraph::fromWeightedEdges(n, roads, true);
+
+    // Social-like graph with shuffled ids
+    vector<pair<int, int>> friendships;
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    for (long long e = 0; e < 8LL * n; e++) {
+        double a = unit(rng), b = unit(rng);
+        friendships.push_back({label[(int)(n * a * a * a)], label[(int)(n * b)]});
+    }
+    CsrGraph social = CsrGraph::fromEdges(n, friendships, true);
+
+    cout << "  " << left << setw(24) << "graph" << right << setw(8) << "CSR MB" << setw(8) << "VB MB"
+         << setw(8) << "ratio" << setw(10) << "BFS CSR" << setw(10) << "BFS VB"
+         << setw(10) << "DFS CSR" << setw(10) << "DFS VB" << "   (times in ms)\n";
+
+    int mismatches = 0;
+    mismatches += runWorkload("grid, shuffled ids", grid);
+    mismatches += runWorkload("grid, RCM order", reorderGraph(grid, ORDER_RCM).graph);
+    mismatches += runWorkload("social, shuffled ids", social);
+    mismatches += runWorkload("social, BFS order", reorderGraph(social, ORDER_BFS).graph);
+
+    cout << "\nCorrectness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/*
+ * CSR TRAVERSAL BENCHMARK
+ *
+ * Compares graph traversal throughput of the old adjacency-list representation
+ * (vector<vector<int>> / vector<vector<pair<int,int>>>) with the shared CsrGraph
+ * (common/csr_graph.h) on a random graph with one million vertices.
+ *
+ * Traversals (private loops, written once for both representations so the timings differ only
+ * in the graph layout; common/search.h takes CSR / compressed graphs only, and its workspace
+ * and tracing would not be part of the comparison):
+ * - BFS  - queue and visited flags, as bfs() of common/search.h
+ * - DFS  - explicit stack of vertices (recursion would overflow)
+ * - UCS  - Dijkstra with a binary heap, as ucs()
+ *
+ * Reported: milliseconds per traversal and edges scanned per second.
+ *
+ * Usage: ./csr_traversal_benchmark [vertices] [average degree]
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+using namespace std;
+
+using Edge = pair<int, int>;
+
+// Neighbor access for both representations, so every traversal is written once
+inline const vector<int>& neighborsOf(const vector<vector<int>>& graph, int v) { return graph[v]; }
+inline CsrGraph::NeighborRange neighborsOf(const CsrGraph& graph, int v) { return graph.neighbors(v); }
+inline const vector<Edge>& edgesOf(const vector<vector<Edge>>& graph, int v) { return graph[v]; }
+inline CsrGraph::EdgeRange edgesOf(const CsrGraph& graph, int v) { return graph.edges(v); }
+
+/**
+ * Quiet BFS
+ *
+ * @return number of edges scanned
+ */
+template <typename Graph>
+long long bfsCount(const Graph& graph, int n, int start) {
+    vector<bool> visited(n, false);
+    queue<int> q;
+    visited[start] = true;
+    q.push(start);
+    long long scanned = 0;
+
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        for (int neighbor : neighborsOf(graph, node)) {
+            scanned++;
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                q.push(neighbor);
+            }
+        }
+    }
+    return scanned;
+}
+
+/**
+ * Quiet DFS with an explicit stack
+ *
+ * @return number of edges scanned
+ */
+template <typename Graph>
+long long dfsCount(const Graph& graph, int n, int start) {
+    vector<bool> visited(n, false);
+    vector<int> stack = {start};
+    long long scanned = 0;
+
+    while (!stack.empty()) {
+        int node = stack.back();
+        stack.pop_back();
+        if (visited[node]) continue;
+        visited[node] = true;
+        for (int neighbor : neighborsOf(graph, node)) {
+            scanned++;
+            if (!visited[neighbor]) stack.push_back(neighbor);
+        }
+    }
+    return scanned;
+}
+
+/**
+ * Quiet Uniform Cost Search
+ *
+ * @return number of edges scanned
+ */
+template <typename Graph>
+long long ucsCount(const Graph& graph, int n, int start) {
+    vector<bool> visited(n, false);
+    vector<int> cost(n, INT_MAX);
+    priority_queue<Edge, vector<Edge>, greater<Edge>> pq;
+    cost[start] = 0;
+    pq.push({0, start});
+    long long scanned = 0;
+
+    while (!pq.empty()) {
+        auto [currCost, node] = pq.top();
+        pq.pop();
+        if (visited[node]) continue;
+        visited[node] = true;
+        for (auto [neighbor, weight] : edgesOf(graph, node)) {
+            scanned++;
+            int newCost = currCost + weight;
+            if (newCost < cost[neighbor]) {
+                cost[neighbor] = newCost;
+                pq.push({newCost, neighbor});
+            }
+        }
+    }
+    return scanned;
+}
+
+/**
+ * Time one traversal (best of several runs) and print its throughput
+ */
+template <typename Traversal>
+double report(const char* name, Traversal traversal) {
+    const int repeats = 3;
+    double best = 1e30;
+    long long scanned = 0;
+    for (int r = 0; r < repeats; r++) {
+        auto start = chrono::steady_clock::now();
+        scanned = traversal();
+        best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+    }
+    cout << "  " << name << ": " << best * 1000 << " ms, " << scanned / best / 1e6 << " M edges/s\n";
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+
+    // Random undirected graph, built edge by edge like the hand-written examples grow
+    mt19937 rng(42);
+    vector<WeightedEdge> edgeList;
+    for (long long e = 0; e < (long long)n * degree / 2; e++) {
+        edgeList.push_back({(int)(rng() % n), (int)(rng() % n), 1 + (int)(rng() % 100)});
+    }
+
+    vector<vector<int>> adjacency(n);
+    vector<vector<Edge>> weightedAdjacency(n);
+    for (const WeightedEdge& e : edgeList) {
+        adjacency[e.from].push_back(e.to);
+        adjacency[e.to].push_back(e.from);
+        weightedAdjacency[e.from].push_back({e.to, e.weight});
+        weightedAdjacency[e.to].push_back({e.from, e.weight});
+    }
+    CsrGraph graph = CsrGraph::fromWeightedEdges(n, edgeList, true);
+
+    cout << "Random graph: " << n << " vertices, " << graph.numEdges() << " directed edges\n";
+
+    // Same traversal results on both representations
+    bool same = bfsCount(adjacency, n, 0) == bfsCount(graph, n, 0) &&
+                dfsCount(adjacency, n, 0) == dfsCount(graph, n, 0) &&
+                ucsCount(weightedAdjacency, n, 0) == ucsCount(graph, n, 0);
+    cout << "Correctness check: " << (same ? "OK" : "MISMATCH") << endl;
+
+    cout << "\nvector<vector<...>>:\n";
+    double bfsOld = report("BFS", [&] { return bfsCount(adjacency, n, 0); });
+    double dfsOld = report("DFS", [&] { return dfsCount(adjacency, n, 0); });
+    double ucsOld = report("UCS", [&] { return ucsCount(weightedAdjacency, n, 0); });
+
+    cout << "\nCsrGraph:\n";
+    double bfsNew = report("BFS", [&] { return bfsCount(graph, n, 0); });
+    double dfsNew = report("DFS", [&] { return dfsCount(graph, n, 0); });
+    double ucsNew = report("UCS", [&] { return ucsCount(graph, n, 0); });
+
+    cout << "\nSpeedup: BFS " << bfsOld / bfsNew << "x, DFS " << dfsOld / dfsNew
+         << "x, UCS " << ucsOld / ucsNew << "x" << endl;
+
+    return same ? 0 : 1;
+}
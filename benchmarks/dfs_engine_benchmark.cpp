@@ -0,0 +1,139 @@
+/*
+ * DFS ENGINE BENCHMARK
+ *
+ * Deep traversals: recursive DFS (one native call frame per vertex on the path) against the
+ * iterative engine of common/dfs_engine.h (one 8-byte frame per vertex in a contiguous vector).
+ *
+ * Graph: dependency chain 0 -> 1 -> ... -> n - 1 plus random forward shortcuts, so the DFS path
+ * is n vertices deep. With the default 8 MB stack the recursive version crashes after a few
+ * hundred thousand vertices; here it runs on a thread with a 4 GB stack to get a comparison.
+ *
+ * Checks:
+ * - recursive and iterative pre-order are identical
+ * - topologicalOrder() puts every edge u -> v with u first
+ * - stronglyConnectedComponents() finds the blocks closed by back edges (chain with cycles)
+ *
+ * Usage: ./dfs_engine_benchmark [vertices]
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <pthread.h>
+#include "../common/csr_graph.h"
+#include "../common/dfs_engine.h"
+using namespace std;
+
+// Recursive DFS of depth_first_search.cpp before the engine, recording pre-order
+void dfsRecursive(int node, const CsrGraph& graph, vector<bool>& visited, vector<int>& order) {
+    visited[node] = true;
+    order.push_back(node);
+    for (int neighbor : graph.neighbors(node)) {
+        if (!visited[neighbor]) dfsRecursive(neighbor, graph, visited, order);
+    }
+}
+
+struct RecursiveRun {
+    const CsrGraph* graph;
+    vector<int> order;
+    double ms;
+};
+
+void* runRecursive(void* arg) {
+    RecursiveRun* run = static_cast<RecursiveRun*>(arg);
+    vector<bool> visited(run->graph->numVertices(), false);
+    auto start = chrono::steady_clock::now();
+    dfsRecursive(0, *run->graph, visited, run->order);
+    run->ms = chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+    return nullptr;
+}
+
+/**
+ * Chain with `shortcuts` random forward edges per vertex (a DAG), or with a back edge closing
+ * every block of `block` vertices into a cycle when block > 0
+ */
+CsrGraph makeChain(int n, int shortcuts, int block, unsigned seed) {
+    mt19937 rng(seed);
+    vector<pair<int, int>> edges;
+    for (int v = 0; v + 1 < n; v++) {
+        edges.push_back({v, v + 1});
+        for (int s = 0; s < shortcuts; s++) {
+            int to = v + 2 + rng() % 64;
+            if (to < n) edges.push_back({v, to});
+        }
+    }
+    if (block > 0) {
+        for (int first = 0; first + block <= n; first += block) edges.push_back({first + block - 1, first});
+    }
+    return CsrGraph::fromEdges(n, edges, false);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    CsrGraph dag = makeChain(n, 2, 0, 42);
+    cout << "Chain DAG: " << dag.numVertices() << " vertices, " << dag.numEdges() << " edges (DFS depth " << n << ")\n";
+
+    // Recursive DFS on a thread with a stack large enough for the whole path
+    RecursiveRun recursive{&dag, {}, 0};
+    recursive.order.reserve(n);
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, size_t(4) << 30);
+    pthread_t thread;
+    bool recursed = pthread_create(&thread, &attr, runRecursive, &recursive) == 0;
+    if (recursed) pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attr);
+
+    // Iterative engine on the default stack
+    vector<bool> visited(n, false);
+    vector<int> order;
+    order.reserve(n);
+    DfsEngine<CsrGraph> engine(dag);
+    auto start = chrono::steady_clock::now();
+    engine.run(0, [&](int v, int, int) {
+        if (visited[v]) return DFS_SKIP;
+        visited[v] = true;
+        order.push_back(v);
+        return DFS_ENTER;
+    });
+    double iterativeMs = chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+
+    bool ok = (int)order.size() == n && (!recursed || order == recursive.order);
+
+    start = chrono::steady_clock::now();
+    vector<int> topo;
+    bool acyclic = topologicalOrder(dag, topo);
+    double topoMs = chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+    vector<int> position(n);
+    for (int i = 0; i < (int)topo.size(); i++) position[topo[i]] = i;
+    ok = ok && acyclic && (int)topo.size() == n;
+    for (int u = 0; ok && u < n; u++) {
+        for (int v : dag.neighbors(u)) ok = ok && position[u] < position[v];
+    }
+
+    const int block = 1000;
+    CsrGraph cyclic = makeChain(n, 2, block, 7);
+    vector<int> topoCyclic;
+    ok = ok && !topologicalOrder(cyclic, topoCyclic);
+    start = chrono::steady_clock::now();
+    vector<int> component;
+    int count = stronglyConnectedComponents(cyclic, component);
+    double sccMs = chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+    int expectedCount = n / block + n % block;  // Full blocks, then one component per leftover vertex
+    ok = ok && count == expectedCount;
+    for (int v = 0; ok && v < n / block * block; v++) ok = component[v] == component[v - v % block];
+
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+    if (recursed) {
+        cout << "  recursive dfs (4 GB thread stack): " << recursive.ms << " ms\n";
+    } else {
+        cout << "  recursive dfs: could not create a thread with a 4 GB stack\n";
+    }
+    cout << "  iterative engine (default stack):  " << iterativeMs << " ms";
+    if (recursed) cout << " (" << recursive.ms / iterativeMs << "x)";
+    cout << "\n  topologicalOrder:                  " << topoMs << " ms\n";
+    cout << "  stronglyConnectedComponents:       " << sccMs << " ms (" << count << " components)\n";
+    return ok ? 0 : 1;
+}
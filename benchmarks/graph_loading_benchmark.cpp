@@ -0,0 +1,211 @@
+/*
+ * GRAPH LOADING BENCHMARK
+ *
+ * Compares the ways of getting a large graph into a CsrGraph (common/graph_file.h):
+ * - iostream parsing ("ifstream >> from >> to >> weight"), the usual textbook approach
+ * - importEdgeList() - parallel parser over the mapped text file
+ * - mapGraphFile()   - zero-copy mmap of the binary graph file, with and without the verify pass
+ *
+ * Crafted files (header offset inside the header, decreasing offsets, out-of-range target) must
+ * be rejected by the verified mapGraphFile().
+ * Without arguments a random weighted edge list is generated in the temp directory.
+ * With arguments the program converts a real edge list / DIMACS file:
+ *
+ * Usage: ./graph_loading_benchmark [edge list or .gr file] [output .csr file] [--undirected]
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <cstdio>
+#include "../common/graph_file.h"
+using namespace std;
+
+/**
+ * Reference loader: iostreams and an edge vector (leading '#' lines, then "from to weight" lines)
+ */
+CsrGraph loadWithIostream(const char* path) {
+    ifstream in(path);
+    vector<WeightedEdge> edges;
+    string comment;
+    while (in.peek() == '#') getline(in, comment);
+    int from, to, weight, n = 0;
+    while (in >> from >> to >> weight) {
+        edges.push_back({from, to, weight});
+        n = max(n, max(from, to) + 1);
+    }
+    return CsrGraph::fromWeightedEdges(n, edges);
+}
+
+/**
+ * Quiet BFS from vertex 0
+ *
+ * @return number of reached vertices
+ */
+int bfsReached(const CsrGraph& graph) {
+    if (graph.numVertices() == 0) return 0;
+    vector<bool> visited(graph.numVertices(), false);
+    queue<int> q;
+    visited[0] = true;
+    q.push(0);
+    int reached = 1;
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        for (int neighbor : graph.neighbors(node)) {
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                q.push(neighbor);
+                reached++;
+            }
+        }
+    }
+    return reached;
+}
+
+/**
+ * Same vertices, edges and weights in the same order
+ */
+bool sameGraph(const CsrGraph& a, const CsrGraph& b) {
+    if (a.numVertices() != b.numVertices() || a.numEdges() != b.numEdges() || a.weighted() != b.weighted()) return false;
+    size_t n = a.numVertices(), m = a.numEdges();
+    return memcmp(a.offsetData(), b.offsetData(), (n + 1) * sizeof(int)) == 0 &&
+           memcmp(a.targetData(), b.targetData(), m * sizeof(int)) == 0 &&
+           (!a.weighted() || memcmp(a.weightData(), b.weightData(), m * sizeof(int)) == 0);
+}
+
+/**
+ * Overwrite one value of a written graph file in place
+ */
+template <typename T>
+void patchFile(const char* path, uint64_t byteOffset, T value) {
+    fstream file(path, ios::in | ios::out | ios::binary);
+    file.seekp(byteOffset);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Write a 4-vertex cycle, apply one corruption and count how many are accepted by mapGraphFile(verify)
+ */
+int acceptedCraftedFiles(const char* path) {
+    CsrGraph cycle = CsrGraph::fromWeightedEdges(4, {{0, 1, 1}, {1, 2, 1}, {2, 3, 1}, {3, 0, 1}});
+    GraphFileHeader header = {};
+    header.offsetsOffset = graphFileAlign(sizeof(GraphFileHeader));     // Layout of writeGraphFile
+    header.targetsOffset = graphFileAlign(header.offsetsOffset + 5 * sizeof(int));
+    struct { uint64_t at; uint64_t value; bool header; } crafted[] = {
+        {offsetof(GraphFileHeader, targetsOffset), 0, true},            // targets inside the header
+        {header.offsetsOffset + 1 * sizeof(int), 3, false},             // offsets 0 3 2 3 4
+        {header.targetsOffset + 2 * sizeof(int), 4, false},             // edge to vertex 4 of 4
+        {header.targetsOffset, (uint64_t)-1, false},                    // edge to vertex -1
+    };
+    int accepted = 0;
+    for (const auto& c : crafted) {
+        if (!writeGraphFile(path, cycle)) return -1;
+        if (c.header) patchFile<uint64_t>(path, c.at, c.value);
+        else patchFile<int>(path, c.at, (int)c.value);
+        GraphFile file;
+        if (mapGraphFile(path, file, true)) accepted++;
+    }
+    return accepted;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    // Conversion mode: edge list -> binary graph file
+    if (argc >= 3) {
+        bool undirected = argc > 3 && strcmp(argv[3], "--undirected") == 0;
+        CsrGraph graph;
+        auto start = chrono::steady_clock::now();
+        if (!importEdgeList(argv[1], graph, undirected)) return 1;
+        cout << "Imported " << graph.numVertices() << " vertices, " << graph.numEdges() << " edges in "
+             << secondsSince(start) << " s\n";
+        if (!writeGraphFile(argv[2], graph)) return 1;
+        GraphFile written;
+        if (!mapGraphFile(argv[2], written, true)) return 1;
+        cout << "Wrote and verified " << argv[2] << endl;
+        return 0;
+    }
+
+    string textPath = "/tmp/graph_loading_benchmark.txt";
+    string binaryPath = "/tmp/graph_loading_benchmark.csr";
+    const int n = 1000000;
+    const int m = 10000000;
+
+    // Random weighted edge list
+    {
+        ofstream out(textPath);
+        out << "# random graph: from to weight\n";
+        mt19937 rng(42);
+        for (int e = 0; e < m; e++) {
+            out << rng() % n << ' ' << rng() % n << ' ' << 1 + rng() % 100 << '\n';
+        }
+    }
+    cout << "Edge list: " << n << " vertices, " << m << " edges\n";
+
+    auto start = chrono::steady_clock::now();
+    CsrGraph slow = loadWithIostream(textPath.c_str());
+    double iostreamSeconds = secondsSince(start);
+
+    vector<double> importSeconds;
+    CsrGraph fast;
+    vector<int> threadCounts = {1};
+    if (thread::hardware_concurrency() > 1) threadCounts.push_back(thread::hardware_concurrency());
+    for (int threads : threadCounts) {
+        start = chrono::steady_clock::now();
+        if (!importEdgeList(textPath.c_str(), fast, false, threads)) return 1;
+        importSeconds.push_back(secondsSince(start));
+    }
+
+    // Heuristic column: any per-vertex values round-trip through the file
+    vector<int> heuristic(fast.numVertices());
+    for (int v = 0; v < fast.numVertices(); v++) heuristic[v] = v % 1000;
+    start = chrono::steady_clock::now();
+    if (!writeGraphFile(binaryPath.c_str(), fast, heuristic.data())) return 1;
+    double writeSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    GraphFile file;
+    if (!mapGraphFile(binaryPath.c_str(), file)) return 1;
+    double mapSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    GraphFile verified;
+    if (!mapGraphFile(binaryPath.c_str(), verified, true)) return 1;
+    double verifySeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    int reached = bfsReached(file.graph);
+    double firstBfsSeconds = secondsSince(start);
+
+    bool ok = sameGraph(slow, fast) && sameGraph(fast, file.graph) && file.heuristic != nullptr &&
+              memcmp(file.heuristic, heuristic.data(), heuristic.size() * sizeof(int)) == 0 &&
+              bfsReached(slow) == reached && sameGraph(file.graph, verified.graph);
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+    bool rejected = acceptedCraftedFiles(binaryPath.c_str()) == 0;  // Prints one mapGraphFile error each
+    cout << "Crafted files rejected: " << (rejected ? "OK" : "MISMATCH") << endl;
+    ok = ok && rejected;
+
+    cout << "\nLoad times:\n";
+    cout << "  iostream parse:             " << iostreamSeconds * 1000 << " ms\n";
+    for (size_t i = 0; i < threadCounts.size(); i++) {
+        cout << "  importEdgeList, " << threadCounts[i] << " thread(s): " << importSeconds[i] * 1000
+             << " ms (" << iostreamSeconds / importSeconds[i] << "x)\n";
+    }
+    cout << "  writeGraphFile:             " << writeSeconds * 1000 << " ms\n";
+    cout << "  mapGraphFile:               " << mapSeconds * 1000 << " ms\n";
+    cout << "  mapGraphFile, verify:       " << verifySeconds * 1000 << " ms\n";
+    cout << "  first BFS on mapped graph:  " << firstBfsSeconds * 1000 << " ms (" << reached << " vertices reached)\n";
+
+    remove(textPath.c_str());
+    remove(binaryPath.c_str());
+    return ok ? 0 : 1;
+}
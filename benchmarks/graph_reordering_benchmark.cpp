@@ -0,0 +1,147 @@
+/*
+ * GRAPH REORDERING BENCHMARK
+ *
+ * Measures how vertex relabeling (common/graph_reorder.h) changes the speed of the existing
+ * traversals when the input ids are random, as in most imported graphs.
+ *
+ * Graphs (vertex ids shuffled before the measurement):
+ * - Road-like: 1000 x 1000 grid, 4 neighbors, weights 1..10, A* with Manhattan distance
+ * - Social-like: 1M vertices with a skewed (power-law-like) degree distribution
+ *
+ * Traversals (common/search.h, NoTrace):
+ * - BFS  - bfs(), all distances from one vertex
+ * - DFS  - dfs(), iterative engine of common/dfs_engine.h
+ * - A*   - aStar(), corner to corner (grid only)
+ *
+ * All queries are issued and checked in ORIGINAL ids through the kept permutation.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <algorithm>
+#include "../common/csr_graph.h"
+#include "../common/graph_reorder.h"
+#include "../common/search.h"
+using namespace std;
+
+/**
+ * Hop distance of every vertex after bfs() of common/search.h (-1 = unreachable)
+ */
+vector<int> bfsDistances(const CsrGraph& graph, int start) {
+    SearchWorkspace& workspace = SearchWorkspace::forThread();
+    bfs(start, graph, -1, workspace);
+    vector<int> dist(graph.numVertices());
+    for (int v = 0; v < graph.numVertices(); v++) dist[v] = workspace.cost(v) == INT_MAX ? -1 : workspace.cost(v);
+    return dist;
+}
+
+// Best-of-3 wall time of one call, in milliseconds
+template <typename Work>
+double timeMs(Work work) {
+    double best = 1e30;
+    for (int r = 0; r < 3; r++) {
+        auto start = chrono::steady_clock::now();
+        work();
+        best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000);
+    }
+    return best;
+}
+
+// Results are written here so the compiler cannot discard the calls
+volatile int benchmarkSink;
+
+/**
+ * Time the traversals on the original graph and on every reordering
+ *
+ * @param graph - graph with shuffled ids
+ * @param start - query source (original id)
+ * @param goal - A* goal (original id), -1 to skip A*
+ * @param heuristic - h(n) by original id (empty to skip A*)
+ * @return number of mismatches against the original graph
+ */
+int runWorkload(const char* name, const CsrGraph& graph, int start, int goal, const vector<int>& heuristic) {
+    cout << "\n" << name << ": " << graph.numVertices() << " vertices, " << graph.numEdges() << " edges\n";
+    cout << left << setw(14) << "  ordering" << setw(14) << "reorder ms" << setw(10) << "BFS ms"
+         << setw(10) << "DFS ms" << (goal >= 0 ? "A* ms" : "") << right << "\n";
+
+    vector<int> referenceDist = bfsDistances(graph, start);
+    int referenceCost = goal >= 0 ? aStar(start, goal, graph, heuristic).cost : 0;
+    auto printRow = [&](const char* label, double reorderMs, const CsrGraph& g, int s, int t, const vector<int>& h) {
+        cout << "  " << left << setw(12) << label << setw(14) << reorderMs
+             << setw(10) << timeMs([&] { benchmarkSink = bfs(s, g).expanded; })
+             << setw(10) << timeMs([&] { benchmarkSink = dfs(s, g).expanded; });
+        if (t >= 0) cout << timeMs([&] { benchmarkSink = aStar(s, t, g, h).cost; });
+        cout << right << "\n";
+    };
+    printRow("original", 0, graph, start, goal, heuristic);
+
+    int mismatches = 0;
+    const pair<GraphOrdering, const char*> orderings[] = {{ORDER_BFS, "BFS"}, {ORDER_RCM, "RCM"}, {ORDER_DEGREE, "degree"}};
+    for (auto [ordering, label] : orderings) {
+        auto begin = chrono::steady_clock::now();
+        ReorderedGraph r = reorderGraph(graph, ordering);
+        double reorderMs = chrono::duration<double>(chrono::steady_clock::now() - begin).count() * 1000;
+
+        // Queries in original ids: translate in, translate results back
+        vector<int> h = goal >= 0 ? r.permuteValues(heuristic) : vector<int>();
+        int s = r.toNew(start), t = goal >= 0 ? r.toNew(goal) : -1;
+        if (r.restoreValues(bfsDistances(r.graph, s)) != referenceDist) mismatches++;
+        if (t >= 0 && aStar(s, t, r.graph, h).cost != referenceCost) mismatches++;
+
+        printRow(label, reorderMs, r.graph, s, t, h);
+    }
+    return mismatches;
+}
+
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    mt19937 rng(42);
+
+    // Road-like grid with shuffled ids
+    int n = side * side;
+    vector<int> label(n);  // label[grid cell] = vertex id
+    for (int v = 0; v < n; v++) label[v] = v;
+    shuffle(label.begin(), label.end(), rng);
+
+    vector<WeightedEdge> roads;
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            int cell = y * side + x;
+            if (x + 1 < side) roads.push_back({label[cell], label[cell + 1], 1 + (int)(rng() % 10)});
+            if (y + 1 < side) roads.push_back({label[cell], label[cell + side], 1 + (int)(rng() % 10)});
+        }
+    }
+    CsrGraph grid = CsrGraph::fromWeightedEdges(n, roads, true);
+
+    // Manhattan distance to the far corner: admissible because every weight is >= 1
+    vector<int> heuristic(n);
+    for (int cell = 0; cell < n; cell++) heuristic[label[cell]] = (side - 1 - cell % side) + (side - 1 - cell / side);
+
+    int mismatches = runWorkload("Road-like grid", grid, label[0], label[n - 1], heuristic);
+
+    // Social-like graph: endpoints drawn with a cubic bias give a few hubs and a long tail
+    vector<pair<int, int>> friendships;
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    for (long long e = 0; e < 8LL * n; e++) {
+        double a = unit(rng), b = unit(rng);
+        friendships.push_back({(int)(n * a * a * a), (int)(n * b)});
+    }
+    vector<int> shuffled(n);
+    for (int v = 0; v < n; v++) shuffled[v] = v;
+    shuffle(shuffled.begin(), shuffled.end(), rng);
+    for (auto& [from, to] : friendships) {
+        from = shuffled[from];
+        to = shuffled[to];
+    }
+    CsrGraph social = CsrGraph::fromEdges(n, friendships, true);
+
+    mismatches += runWorkload("Social-like graph", social, shuffled[0], -1, {});
+
+    cout << "\nCorrectness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/*
+ * ALT LANDMARK BENCHMARK
+ *
+ * Random point-to-point queries on a road graph with aStar (common/search.h) and:
+ * - h = 0                    - plain Dijkstra, what goal-agnostic routing fell back to
+ * - Euclidean distance       - the coordinate heuristic (synthetic graph only; one O(V) vector per goal)
+ * - ALT, farthest landmarks  - common/landmarks.h
+ * - ALT, avoid landmarks     - k = 8, 16, and k = 16 with the 4 best landmarks per query (active)
+ *
+ * Reported: preprocessing time, table size, settled (expanded) nodes per query and the reduction
+ * against Dijkstra, time per query. Every path cost is checked against Dijkstra.
+ *
+ * Graph: random geometric road-like graph (common/graph_generators.h), or a DIMACS / edge-list
+ * file such as USA-road-d.NY.gr (common/graph_file.h, build with -pthread).
+ *
+ * Usage: ./landmark_benchmark [road vertices | graph file] [queries]
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <cctype>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/graph_file.h"
+#include "../common/search.h"
+#include "../common/landmarks.h"
+using namespace std;
+
+// Wall time of one call, in milliseconds
+template <typename Work>
+double timeMs(Work work) {
+    auto start = chrono::steady_clock::now();
+    work();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+}
+
+struct Query {
+    int start;
+    int goal;
+    int cost;  // Dijkstra's answer
+};
+
+// Average settled nodes of the last run, for the reduction column
+double dijkstraSettled = 0;
+
+/**
+ * Run every query with aStar and heuristicFor(query); returns false on a wrong cost
+ */
+template <typename HeuristicFor>
+bool run(const string& name, const CsrGraph& graph, const vector<Query>& queries, HeuristicFor heuristicFor,
+         const LandmarkTable* table = nullptr) {
+    long long settled = 0;
+    double ms = 0;
+    bool ok = true;
+    for (const Query& q : queries) {
+        auto h = heuristicFor(q);
+        SearchResult result;
+        ms += timeMs([&] { result = aStar(q.start, q.goal, graph, h); });
+        settled += result.expanded;
+        ok = ok && result.cost == q.cost;
+    }
+    double average = (double)settled / queries.size();
+    cout << "  " << name << ": " << (long long)average << " settled/query ("
+         << dijkstraSettled / average << "x fewer), " << ms / queries.size() << " ms/query";
+    if (table) {
+        cout << ", build " << table->buildSeconds() << " s, " << table->memoryBytes() / (1 << 20) << " MB"
+             << (table->symmetric() ? " (symmetric: one table)" : "");
+    }
+    cout << (ok ? "" : "  WRONG COST") << endl;
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    bool fromFile = argc > 1 && !isdigit((unsigned char)argv[1][0]);
+    int roadVertices = argc > 1 && !fromFile ? atoi(argv[1]) : 1 << 19;
+    int queryCount = argc > 2 ? atoi(argv[2]) : 100;
+
+    GeneratedGraph generated;
+    if (fromFile) {
+        if (!importEdgeList(argv[1], generated.graph)) return 1;
+    } else {
+        generated = generateGeometric(roadVertices, 6, 42);
+    }
+    const CsrGraph& graph = generated.graph;
+    cout << "Graph: " << graph.numVertices() << " vertices, " << graph.numEdges() << " edges, "
+         << queryCount << " random queries\n";
+
+    // Random endpoints inside the largest component, answered by Dijkstra (ucs with a goal)
+    int root = largestComponentVertex(graph);
+    SearchWorkspace component;
+    bfs(root, graph, -1, component);
+    mt19937 rng(7);
+    vector<Query> queries;
+    long long settled = 0;
+    double dijkstraMs = 0;
+    while ((int)queries.size() < queryCount) {
+        int start = rng() % graph.numVertices(), goal = rng() % graph.numVertices();
+        if (!component.visited(start) || !component.visited(goal)) continue;
+        SearchResult result;
+        dijkstraMs += timeMs([&] { result = ucs(start, graph, goal); });
+        settled += result.expanded;
+        queries.push_back({start, goal, result.cost});
+    }
+    dijkstraSettled = (double)settled / queryCount;
+    cout << "  Dijkstra (h = 0): " << (long long)dijkstraSettled << " settled/query, "
+         << dijkstraMs / queryCount << " ms/query\n";
+
+    bool ok = true;
+    if (!fromFile) {
+        ok = run("Euclidean", graph, queries, [&](const Query& q) { return generated.heuristicTo(q.goal); }) && ok;
+    }
+    LandmarkTable farthest(graph, 16, LANDMARKS_FARTHEST);
+    ok = run("ALT farthest k=16", graph, queries, [&](const Query& q) { return farthest.heuristicTo(q.goal); },
+             &farthest) && ok;
+    LandmarkTable avoid8(graph, 8, LANDMARKS_AVOID);
+    ok = run("ALT avoid k=8", graph, queries, [&](const Query& q) { return avoid8.heuristicTo(q.goal); },
+             &avoid8) && ok;
+    LandmarkTable avoid16(graph, 16, LANDMARKS_AVOID);
+    ok = run("ALT avoid k=16", graph, queries, [&](const Query& q) { return avoid16.heuristicTo(q.goal); },
+             &avoid16) && ok;
+    ok = run("ALT avoid k=16, 4 active", graph, queries,
+             [&](const Query& q) { return avoid16.heuristicTo(q.goal, q.start, 4); }) && ok;
+
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+/*
+ * PRIORITY QUEUE BENCHMARK
+ *
+ * ucs and aStar compiled against each queue of common/priority_queues.h:
+ * - HeapQueue   - binary heap (std::priority_queue), the default
+ * - RadixHeap   - monotone radix heap
+ * - BucketQueue - Dial's buckets, window = largest edge weight
+ * - IndexedHeap - d-ary heap with decrease-key (d = 2, 4, 8)
+ *
+ * Graphs (common/graph_generators.h):
+ * - grid: side x side grid, 20% obstacles, weights 1..10, Manhattan heuristic
+ * - road: random geometric graph, weight = rounded-up length (up to ~1500), Euclidean heuristic
+ * - rmat: dense R-MAT power-law graph (32 edges per vertex), weights 1..100, no heuristic
+ *         (A* = Dijkstra); lazy queues collect many duplicate entries here
+ *
+ * Work: UCS from one start to every vertex, and A* queries to vertices at growing hop distance.
+ * Reported: time and the largest open list of the UCS run.
+ *
+ * The searches are ucs<Queue> and aStar<Queue> of common/search.h (NoTrace, one reused
+ * SearchWorkspace); a wrapper around the queue records the largest open list.
+ *
+ * Usage: ./priority_queue_benchmark [grid side] [road vertices] [rmat scale]
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search.h"
+#include "../common/priority_queues.h"
+using namespace std;
+
+// Largest number of entries in the open list during the last search
+size_t maxOpen = 0;
+
+// Queue wrapper for the library searches: records the open list size after every push
+template <typename Queue>
+struct OpenListSize : Queue {
+    explicit OpenListSize(const Queue& prototype) : Queue(prototype) {}
+    void push(int key, int value) {
+        Queue::push(key, value);
+        maxOpen = max(maxOpen, Queue::size());
+    }
+};
+
+template <typename Work>
+double timeMs(Work work) {
+    auto start = chrono::steady_clock::now();
+    work();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+}
+
+// One workload: UCS from start to every vertex, then A* to each goal
+struct Workload {
+    const CsrGraph* graph;
+    int start;
+    vector<int> goals;
+    vector<vector<int>> heuristics;  // heuristics[q] = h(n) towards goals[q]
+};
+
+struct Result {
+    double ucsMs = 0, aStarMs = 0;
+    size_t ucsOpen = 0;
+    long long checksum = 0;          // UCS cost sum plus every A* path cost
+};
+
+template <typename Queue>
+Result runQueue(const Workload& work, const Queue& prototype) {
+    SearchWorkspace& ws = SearchWorkspace::forThread();
+    Result result;
+    maxOpen = 0;
+    result.ucsMs = timeMs([&] { ucs(work.start, *work.graph, -1, ws, OpenListSize<Queue>(prototype)); });
+    result.ucsOpen = maxOpen;
+    for (int v = 0; v < work.graph->numVertices(); v++) {
+        if (ws.cost(v) != INT_MAX) result.checksum += ws.cost(v);  // Sum of all finite costs
+    }
+    for (size_t q = 0; q < work.goals.size(); q++) {
+        result.aStarMs += timeMs([&] {
+            result.checksum += aStar(work.start, work.goals[q], *work.graph, work.heuristics[q], ws, prototype).cost;
+        });
+    }
+    return result;
+}
+
+// Returns false if the queues disagree
+bool measure(const string& name, const GeneratedGraph& generated, int queries, int hopStep) {
+    const CsrGraph& graph = generated.graph;
+    int maxWeight = 1;
+    for (int e = 0; e < graph.numEdges(); e++) maxWeight = max(maxWeight, graph.weightData()[e]);
+    cout << name << ": " << graph.numVertices() << " vertices, " << graph.numEdges()
+         << " edges, weights up to " << maxWeight << endl;
+
+    // A* goals at growing hop distances from start (h = 0 without coordinates)
+    Workload work{&graph, largestComponentVertex(graph), {}, {}};
+    for (int q = 0; q < queries; q++) {
+        int goal = farthestVertex(graph, work.start, (q + 1) * hopStep);
+        work.goals.push_back(goal);
+        work.heuristics.push_back(generated.heuristicTo(goal));
+    }
+
+    const char* names[] = {"binary heap      ", "indexed 2-ary    ", "indexed 4-ary    ",
+                           "indexed 8-ary    ", "radix heap       ", "Dial buckets     "};
+    Result results[] = {runQueue(work, HeapQueue<int>()),
+                        runQueue(work, IndexedHeap<2>()),
+                        runQueue(work, IndexedHeap<4>()),
+                        runQueue(work, IndexedHeap<8>()),
+                        runQueue(work, RadixHeap<int>()),
+                        runQueue(work, BucketQueue<int>(maxWeight))};
+    bool ok = true;
+    for (int i = 0; i < 6; i++) {
+        ok = ok && results[i].checksum == results[0].checksum;
+        cout << "  " << names[i] << "ucs: " << results[i].ucsMs << " ms (" << results[0].ucsMs / results[i].ucsMs
+             << "x, open list up to " << results[i].ucsOpen << ")   aStar x" << queries << ": "
+             << results[i].aStarMs << " ms (" << results[0].aStarMs / results[i].aStarMs << "x)\n";
+    }
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 2000;
+    int roadVertices = argc > 2 ? atoi(argv[2]) : 1 << 20;
+    int rmatScale = argc > 3 ? atoi(argv[3]) : 18;
+
+    bool ok = measure("grid", generateGrid(side, side, 1, 0.2, 10, 7), 5, 200);
+    ok = measure("road", generateGeometric(roadVertices, 6, 42), 5, 100) && ok;
+    ok = measure("rmat", generateRmat(rmatScale, 32, 100, 42), 5, 1) && ok;
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+/*
+ * REACHABILITY INDEX BENCHMARK
+ *
+ * "Can a reach b" queries: a BFS per query (stops at the target) against ReachabilityIndex
+ * (common/reachability_index.h). Reports build time, index size and which step answered.
+ *
+ * Graphs (directed):
+ * - rmat:  R-MAT power-law graph (common/graph_generators.h), edges oriented from lower to
+ *          higher id, 2% of them reversed so that large strongly connected components form
+ * - chain: dependency chain with random forward shortcuts and a back edge closing every block
+ *          of 1000 vertices into a cycle
+ *
+ * Usage: ./reachability_index_benchmark [rmat scale] [chain vertices] [queries]
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search_workspace.h"
+#include "../common/reachability_index.h"
+using namespace std;
+
+// BFS from source that stops at target (breadth_first_search.cpp loop)
+bool bfsReachable(const CsrGraph& graph, int source, int target, SearchWorkspace& ws) {
+    ws.begin(graph.numVertices());
+    queue<int> q;
+    q.push(source);
+    ws.markVisited(source);
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        if (node == target) return true;
+        for (int neighbor : graph.neighbors(node)) {
+            if (!ws.visited(neighbor)) {
+                ws.markVisited(neighbor);
+                q.push(neighbor);
+            }
+        }
+    }
+    return false;
+}
+
+CsrGraph directedRmat(int scale, unsigned seed) {
+    GeneratedGraph rmat = generateRmat(scale, 8, 1, seed);
+    const CsrGraph& g = rmat.graph;
+    mt19937 rng(seed);
+    vector<pair<int, int>> edges;
+    for (int u = 0; u < g.numVertices(); u++) {
+        for (int v : g.neighbors(u)) {
+            if (u < v) edges.push_back(rng() % 50 == 0 ? make_pair(v, u) : make_pair(u, v));
+        }
+    }
+    return CsrGraph::fromEdges(g.numVertices(), edges);
+}
+
+CsrGraph chainWithCycles(int n, int block, unsigned seed) {
+    mt19937 rng(seed);
+    vector<pair<int, int>> edges;
+    for (int v = 0; v + 1 < n; v++) {
+        edges.push_back({v, v + 1});
+        for (int s = 0; s < 2; s++) {
+            int to = v + 2 + rng() % 64;
+            if (to < n) edges.push_back({v, to});
+        }
+    }
+    for (int first = 0; first + block <= n; first += block) edges.push_back({first + block - 1, first});
+    return CsrGraph::fromEdges(n, edges);
+}
+
+// Returns false on a wrong answer
+bool measure(const string& name, const CsrGraph& graph, int queries) {
+    cout << name << ": " << graph.numVertices() << " vertices, " << graph.numEdges() << " edges\n";
+    ReachabilityIndex index(graph, 3);
+    size_t graphBytes = (size_t)(graph.numVertices() + 1 + graph.numEdges()) * sizeof(int);
+    cout << "  index: " << index.numComponents() << " components, " << index.condensationEdges()
+         << " DAG edges, " << index.numLabels() << " labels, built in " << index.buildSeconds() * 1000
+         << " ms, " << index.memoryBytes() / 1e6 << " MB (graph: " << graphBytes / 1e6 << " MB)\n";
+
+    mt19937 rng(7);
+    vector<pair<int, int>> pairs(queries);
+    for (auto& [a, b] : pairs) {
+        a = rng() % graph.numVertices();
+        b = rng() % graph.numVertices();
+    }
+
+    // Index: every query, counting which step answered
+    long long steps[4] = {0, 0, 0, 0};
+    vector<bool> answers(queries);
+    auto start = chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+        ReachabilityStep step;
+        answers[q] = index.reachable(pairs[q].first, pairs[q].second, &step);
+        steps[step]++;
+    }
+    double indexMs = chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+
+    // BFS: a sample of the queries (each may scan the whole graph)
+    int sample = min(queries, 200);
+    SearchWorkspace& ws = SearchWorkspace::forThread();
+    int wrong = 0, positive = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < sample; q++) {
+        bool expected = bfsReachable(graph, pairs[q].first, pairs[q].second, ws);
+        positive += expected;
+        if (expected != answers[q]) wrong++;
+    }
+    double bfsMs = chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+
+    double perIndex = indexMs * 1000 / queries, perBfs = bfsMs * 1000 / sample;
+    cout << "  answered by: same SCC " << steps[REACH_SAME_COMPONENT] << ", topological order "
+         << steps[REACH_ORDER] << ", labels " << steps[REACH_LABELS] << ", pruned DFS "
+         << steps[REACH_SEARCH] << " (of " << queries << ")\n";
+    cout << "  BFS per query:   " << perBfs << " us (" << positive << "/" << sample << " reachable)\n";
+    cout << "  index per query: " << perIndex << " us (" << perBfs / perIndex << "x)\n";
+    return wrong == 0;
+}
+
+int main(int argc, char* argv[]) {
+    int scale = argc > 1 ? atoi(argv[1]) : 18;
+    int chain = argc > 2 ? atoi(argv[2]) : 2000000;
+    int queries = argc > 3 ? atoi(argv[3]) : 1000000;
+
+    bool ok = measure("rmat", directedRmat(scale, 42), queries);
+    ok = measure("chain", chainWithCycles(chain, 1000, 42), queries) && ok;
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+    return ok ? 0 : 1;
+}
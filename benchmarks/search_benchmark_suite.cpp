@@ -0,0 +1,326 @@
+/*
+ * SEARCH BENCHMARK SUITE
+ *
+ * Runs all ten algorithms of the repository on synthetic workloads large enough to measure,
+ * and reports numbers that can be tracked from run to run.
+ *
+ * Workloads:
+ * - Arrays: random unsorted ints (Linear Search) and the same values sorted (Binary Search)
+ * - grid2d:    2D grid, 20% obstacles, weights 1..10        (common/graph_generators.h)
+ * - grid3d:    3D grid, 20% obstacles, weights 1..10
+ * - rmat:      R-MAT power-law graph, weights 1..10 (no coordinates: no informed searches)
+ * - geometric: random geometric road-like graph, weight = length
+ *
+ * Algorithms (common/array_search.h, and the graph searches of common/search.h with the default
+ * NoTrace policy and one SearchWorkspace reused by every run):
+ * - linearSearch, binarySearch                       - a batch of lookups
+ * - bfs, dfs, ucs                                    - full traversal from one start vertex
+ * - aStar, greedyBestFirstSearch, bidirectionalBFS   - start to the farthest vertex (BFS hops)
+ * - iddfs                                            - goal a few dozen hops away
+ * - idaStar                                          - goal a few hops away, with an expansion
+ *                                                      budget (IDA* is exponential on weighted
+ *                                                      graphs with many distinct f values)
+ *
+ * Reported per run (best wall time of --repeat runs):
+ * - time_ms       - wall time
+ * - expanded      - vertices expanded (graphs) or array elements examined (arrays)
+ * - mexp_per_s    - expanded / time, in millions per second
+ * - peak_rss_mb   - peak resident set size during the run (process total, inputs included)
+ * - extra_rss_mb  - peak minus the resident size before the run (the algorithm's own memory)
+ * - result        - answer of the run (path cost, found / not found), for cross-checks
+ *
+ * Peak RSS is read from /proc/self/status (VmHWM) and reset before each run by writing "5" to
+ * /proc/self/clear_refs (Linux). Elsewhere the process-lifetime peak from getrusage() is used,
+ * so only the first growth is attributed correctly.
+ *
+ * Usage: ./search_benchmark_suite [--size small|medium|large] [--format table|csv|json]
+ *                                 [--repeat N]
+ * Machine-readable output goes to stdout, progress to stderr:
+ *   ./search_benchmark_suite --format csv > results.csv
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <sys/resource.h>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search.h"
+#include "../common/array_search.h"
+using namespace std;
+
+// Outcome of one algorithm call
+struct Run {
+    long long expanded = 0;  // Vertices expanded or elements examined
+    long long answer = 0;    // Cost, index or found flag, used for cross-checks
+};
+
+/* ---------- Measurement ---------- */
+
+// Current (VmRSS) or peak (VmHWM) resident size in kB, 0 if unavailable
+long long procStatusKb(const char* field) {
+    ifstream status("/proc/self/status");
+    string line;
+    size_t length = strlen(field);
+    while (getline(status, line)) {
+        if (line.compare(0, length, field) == 0) return atoll(line.c_str() + length + 1);
+    }
+    return 0;
+}
+
+// Reset the peak resident size to the current one; false if the kernel does not support it
+bool resetPeakRss() {
+    ofstream clearRefs("/proc/self/clear_refs");
+    if (!clearRefs) return false;
+    clearRefs << "5";
+    clearRefs.flush();
+    return (bool)clearRefs;
+}
+
+long long peakRssKb() {
+    long long hwm = procStatusKb("VmHWM:");
+    if (hwm > 0) return hwm;
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;  // kB on Linux
+}
+
+struct Result {
+    string workload;
+    string algorithm;
+    long long size;       // Vertices or array elements
+    long long edges;      // Directed edges (0 for arrays)
+    double timeMs;
+    long long expanded;
+    double peakRssMb;
+    double extraRssMb;
+    long long answer;
+};
+
+struct Suite {
+    int repeat = 3;
+    vector<Result> results;
+
+    /**
+     * Run one algorithm --repeat times, keep the best time and the peak memory
+     */
+    template <typename Work>
+    Run measure(const string& workload, const string& algorithm, long long size, long long edges, Work work) {
+        cerr << "  " << workload << " / " << algorithm << "..." << endl;
+        resetPeakRss();
+        long long before = procStatusKb("VmRSS:");
+        double best = 1e30;
+        Run run;
+        for (int r = 0; r < repeat; r++) {
+            auto start = chrono::steady_clock::now();
+            run = work();
+            best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000);
+        }
+        long long peak = peakRssKb();
+        results.push_back({workload, algorithm, size, edges, best, run.expanded,
+                           peak / 1024.0, max(0LL, peak - before) / 1024.0, run.answer});
+        return run;
+    }
+};
+
+void printTable(const vector<Result>& results) {
+    cout << left << setw(11) << "workload" << setw(23) << "algorithm" << right << setw(10) << "size"
+         << setw(11) << "time ms" << setw(12) << "expanded" << setw(10) << "M/s" << setw(10) << "peak MB"
+         << setw(10) << "extra MB" << setw(12) << "result" << "\n";
+    for (const Result& r : results) {
+        cout << left << setw(11) << r.workload << setw(23) << r.algorithm << right << setw(10) << r.size
+             << fixed << setprecision(2) << setw(11) << r.timeMs << setw(12) << r.expanded
+             << setw(10) << r.expanded / r.timeMs / 1000 << setprecision(1) << setw(10) << r.peakRssMb
+             << setw(10) << r.extraRssMb << setw(12) << r.answer << "\n";
+    }
+}
+
+void printCsv(const vector<Result>& results) {
+    cout << "workload,algorithm,size,edges,time_ms,expanded,mexp_per_s,peak_rss_mb,extra_rss_mb,result\n";
+    for (const Result& r : results) {
+        cout << r.workload << "," << r.algorithm << "," << r.size << "," << r.edges << ","
+             << fixed << setprecision(3) << r.timeMs << "," << r.expanded << ","
+             << r.expanded / r.timeMs / 1000 << "," << r.peakRssMb << "," << r.extraRssMb << ","
+             << r.answer << "\n";
+    }
+}
+
+void printJson(const vector<Result>& results) {
+    cout << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        cout << "  {\"workload\": \"" << r.workload << "\", \"algorithm\": \"" << r.algorithm
+             << "\", \"size\": " << r.size << ", \"edges\": " << r.edges << fixed << setprecision(3)
+             << ", \"time_ms\": " << r.timeMs << ", \"expanded\": " << r.expanded
+             << ", \"mexp_per_s\": " << r.expanded / r.timeMs / 1000
+             << ", \"peak_rss_mb\": " << r.peakRssMb << ", \"extra_rss_mb\": " << r.extraRssMb
+             << ", \"result\": " << r.answer << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    cout << "]\n";
+}
+
+/* ---------- Workloads ---------- */
+
+// Sizes of one preset
+struct Preset {
+    int arraySize;       // Elements of the searched arrays
+    int linearQueries;   // Linear Search lookups (O(n) each)
+    int binaryQueries;   // Binary Search lookups
+    int gridSide;        // 2D grid: side x side
+    int cubeSide;        // 3D grid: side^3
+    int rmatScale;       // R-MAT: 2^scale vertices
+    int geometricPoints;
+    int iddfsHops;       // Hop distance of the IDDFS goal
+    int idaHops;         // Hop distance of the IDA* goal
+    long long idaBudget; // IDA* expansion budget
+};
+
+/**
+ * Run every graph algorithm on one generated graph
+ *
+ * @return number of cross-check failures
+ */
+int runGraph(Suite& suite, const string& name, const GeneratedGraph& generated, const Preset& preset) {
+    const CsrGraph& graph = generated.graph;
+    long long n = graph.numVertices(), m = graph.numEdges();
+    cerr << name << ": " << n << " vertices, " << m << " edges" << endl;
+
+    // Start in the largest component, end at its farthest vertex
+    int start = largestComponentVertex(graph);
+    int goal = farthestVertex(graph, start);
+
+    // answer = vertices reached (traversals), path cost (-1 = not found) or found flag
+    SearchWorkspace workspace;
+    Run reached = suite.measure(name, "bfs", n, m, [&] {
+        SearchResult r = bfs(start, graph, -1, workspace);
+        return Run{r.expanded, r.expanded};
+    });
+    Run dfsReached = suite.measure(name, "dfs", n, m, [&] {
+        SearchResult r = dfs(start, graph, -1, workspace);
+        return Run{r.expanded, r.expanded};
+    });
+    Run ucsRun = suite.measure(name, "ucs", n, m, [&] {
+        SearchResult r = ucs(start, graph, -1, workspace);  // All costs; the goal's is read back
+        return Run{r.expanded, workspace.cost(goal)};
+    });
+    Run meet = suite.measure(name, "bidirectionalBFS", n, m, [&] {
+        SearchResult r = bidirectionalBFS(graph, start, goal);
+        return Run{r.expanded, r.found};
+    });
+
+    int near = farthestVertex(graph, start, preset.iddfsHops);
+    Run deep = suite.measure(name, "iddfs", n, m, [&] {
+        SearchResult r = iddfs(start, near, 2 * preset.iddfsHops, graph, workspace);
+        return Run{r.expanded, r.found};
+    });
+
+    int failures = 0;
+    if (dfsReached.answer != reached.answer) failures++;
+    if (!meet.answer) failures++;
+    if (!deep.expanded) failures++;
+
+    if (generated.hasHeuristic()) {
+        vector<int> h = generated.heuristicTo(goal);
+        Run best = suite.measure(name, "aStar", n, m, [&] {
+            SearchResult r = aStar(start, goal, graph, h, workspace);
+            return Run{r.expanded, r.cost};
+        });
+        Run greedy = suite.measure(name, "greedyBestFirstSearch", n, m, [&] {
+            SearchResult r = greedyBestFirstSearch(start, goal, graph, h, workspace);
+            return Run{r.expanded, r.found};
+        });
+        if (best.answer != ucsRun.answer) failures++;
+        if (!greedy.answer) failures++;
+
+        // answer = path cost, -1 = not found, -2 = budget spent
+        int close = farthestVertex(graph, start, preset.idaHops);
+        vector<int> hClose = generated.heuristicTo(close);
+        Run ida = suite.measure(name, "idaStar", n, m, [&] {
+            SearchResult r = idaStar(start, close, graph, hClose, workspace, preset.idaBudget);
+            return Run{r.expanded, r.found ? r.cost : r.expanded >= preset.idaBudget ? -2 : -1};
+        });
+        if (ida.answer >= 0 && ida.answer != aStar(start, close, graph, hClose, workspace).cost) failures++;
+    }
+    return failures;
+}
+
+int main(int argc, char* argv[]) {
+    string size = "medium", format = "table";
+    Suite suite;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--size") == 0) size = argv[i + 1];
+        else if (strcmp(argv[i], "--format") == 0) format = argv[i + 1];
+        else if (strcmp(argv[i], "--repeat") == 0) suite.repeat = max(1, atoi(argv[i + 1]));
+    }
+
+    Preset preset;
+    if (size == "small") preset = {1 << 20, 16, 1 << 16, 200, 30, 16, 1 << 16, 16, 6, 1000000};
+    else if (size == "large") preset = {1 << 26, 16, 1 << 22, 3000, 200, 22, 1 << 22, 48, 10, 100000000};
+    else preset = {1 << 24, 16, 1 << 20, 1000, 100, 20, 1 << 20, 32, 8, 20000000};
+
+    int failures = 0;
+
+    // Arrays: n random values; the same values sorted for Binary Search
+    {
+        mt19937 rng(42);
+        vector<int> unsorted(preset.arraySize);
+        for (int& value : unsorted) value = (int)(rng() >> 1);
+        vector<int> sorted = unsorted;
+        sort(sorted.begin(), sorted.end());
+        int n = preset.arraySize;
+        cerr << "arrays: " << n << " elements" << endl;
+
+        // Half of the targets are present (at random positions), half most likely absent
+        vector<int> linearTargets(preset.linearQueries), binaryTargets(preset.binaryQueries);
+        for (size_t i = 0; i < linearTargets.size(); i++) linearTargets[i] = i % 2 ? unsorted[rng() % n] : (int)(rng() >> 1);
+        for (size_t i = 0; i < binaryTargets.size(); i++) binaryTargets[i] = i % 2 ? sorted[rng() % n] : (int)(rng() >> 1);
+
+        // answer = number of targets found; Linear Search examines index + 1 elements on a hit
+        Run linear = suite.measure("array", "linearSearch", n, 0, [&] {
+            Run run;
+            for (int target : linearTargets) {
+                int index = linearSearch(unsorted.data(), n, target);
+                run.expanded += index >= 0 ? index + 1 : n;
+                run.answer += index >= 0;
+            }
+            return run;
+        });
+        Run binary = suite.measure("array", "binarySearch", n, 0, [&] {
+            Run run;
+            for (int target : binaryTargets) run.answer += binarySearch(sorted.data(), n, target, &run.expanded) >= 0;
+            return run;
+        });
+        if (linear.answer < preset.linearQueries / 2 || binary.answer < preset.binaryQueries / 2) failures++;
+    }
+
+    {
+        GeneratedGraph grid = generateGrid(preset.gridSide, preset.gridSide, 1, 0.2, 10, 1);
+        failures += runGraph(suite, "grid2d", grid, preset);
+    }
+    {
+        GeneratedGraph cube = generateGrid(preset.cubeSide, preset.cubeSide, preset.cubeSide, 0.2, 10, 2);
+        failures += runGraph(suite, "grid3d", cube, preset);
+    }
+    {
+        GeneratedGraph rmat = generateRmat(preset.rmatScale, 8, 10, 3);
+        failures += runGraph(suite, "rmat", rmat, preset);
+    }
+    {
+        GeneratedGraph roads = generateGeometric(preset.geometricPoints, 6, 4);
+        failures += runGraph(suite, "geometric", roads, preset);
+    }
+
+    if (format == "csv") printCsv(suite.results);
+    else if (format == "json") printJson(suite.results);
+    else printTable(suite.results);
+
+    cerr << "\nCorrectness check: " << (failures == 0 ? "OK" : "MISMATCH") << endl;
+    return failures == 0 ? 0 : 1;
+}
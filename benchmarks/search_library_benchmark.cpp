@@ -0,0 +1,76 @@
+/*
+ * SEARCH LIBRARY BENCHMARK
+ *
+ * Cost of tracing in the expansion loop: the searches of common/search.h with the default
+ * NoTrace policy against a trace that streams "Visited node: X" with endl (one flush per node,
+ * as the demo programs did inside their loops). Trace output goes to /dev/null, so the numbers
+ * are a lower bound for a terminal or a file.
+ *
+ * Graph: side x side grid with 20% obstacles, weights 1..10 (common/graph_generators.h)
+ * Searches: bfs and ucs over the whole component of the start, A* to a far goal (Manhattan h)
+ *
+ * Usage: ./search_library_benchmark [side]
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search.h"
+using namespace std;
+
+ofstream traceSink("/dev/null");
+
+// What the demos printed per expanded node, flushed every line
+struct StreamTrace : NoTrace {
+    static void expand(const SearchStep& step) { traceSink << "Visited node: " << step.node << endl; }
+};
+
+// Wall time of one call, in milliseconds
+template <typename Work>
+double timeMs(Work work) {
+    auto start = chrono::steady_clock::now();
+    work();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+}
+
+void report(const char* name, const SearchResult& quiet, double quietMs, double tracedMs) {
+    cout << "  " << name << ": " << quiet.expanded << " expanded, no trace " << quietMs << " ms, streamed trace "
+         << tracedMs << " ms (" << tracedMs / quietMs << "x)\n";
+}
+
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+
+    GeneratedGraph grid = generateGrid(side, side, 1, 0.2, 10, 7);
+    const CsrGraph& graph = grid.graph;
+    int start = largestComponentVertex(graph);
+    int goal = farthestVertex(graph, start);
+    vector<int> heuristic(graph.numVertices());
+    for (int v = 0; v < graph.numVertices(); v++) {
+        heuristic[v] = abs(grid.coords[2 * v] - grid.coords[2 * goal]) + abs(grid.coords[2 * v + 1] - grid.coords[2 * goal + 1]);
+    }
+    cout << "Grid: " << graph.numVertices() << " vertices, " << graph.numEdges() << " edges\n";
+
+    SearchResult bfsQuiet, bfsTraced, ucsQuiet, ucsTraced, aQuiet, aTraced;
+    double bfsQuietMs = timeMs([&] { bfsQuiet = bfs(start, graph); });
+    double bfsTracedMs = timeMs([&] { bfsTraced = bfs<StreamTrace>(start, graph); });
+    double ucsQuietMs = timeMs([&] { ucsQuiet = ucs(start, graph); });
+    double ucsTracedMs = timeMs([&] { ucsTraced = ucs<HeapQueue<int>, StreamTrace>(start, graph); });
+    double aQuietMs = timeMs([&] { aQuiet = aStar(start, goal, graph, heuristic); });
+    double aTracedMs = timeMs([&] { aTraced = aStar<HeapQueue<int>, StreamTrace>(start, goal, graph, heuristic); });
+
+    bool ok = bfsQuiet.expanded == bfsTraced.expanded && ucsQuiet.expanded == ucsTraced.expanded &&
+              aQuiet.found && aQuiet.cost == aTraced.cost && aQuiet.path == aTraced.path &&
+              aQuiet.path.front() == start && aQuiet.path.back() == goal;
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+
+    report("bfs  ", bfsQuiet, bfsQuietMs, bfsTracedMs);
+    report("ucs  ", ucsQuiet, ucsQuietMs, ucsTracedMs);
+    report("aStar", aQuiet, aQuietMs, aTracedMs);
+    cout << "  aStar path: " << aQuiet.path.size() << " nodes, cost " << aQuiet.cost << endl;
+    return ok ? 0 : 1;
+}
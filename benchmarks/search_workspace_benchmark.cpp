@@ -0,0 +1,186 @@
+/*
+ * SEARCH WORKSPACE BENCHMARK
+ *
+ * Short queries on a large graph: per-call O(V) allocation of visited / cost arrays against the
+ * epoch-stamped SearchWorkspace (common/search_workspace.h), which is reset in O(1).
+ *
+ * Graph: side x side grid with 20% obstacles, weights 1..10 (common/graph_generators.h)
+ * Queries: random start, goal a few hops away
+ *
+ * Searches (same loops as the repository's algorithms, without printing):
+ * - A*    - a_star_search.cpp
+ * - IDDFS - iterative_deepening_depth_first_search.cpp (one visited reset per depth limit)
+ *
+ * Usage: ./search_workspace_benchmark [side] [queries]
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search_workspace.h"
+using namespace std;
+
+struct Node {
+    int id;
+    int g;
+    int f;
+    bool operator>(const Node& other) const { return f > other.f; }
+};
+
+/**
+ * Quiet A* with fresh arrays (as before the workspace); heuristic(v) returns h(v)
+ *
+ * @return cost of the best path, -1 if the goal cannot be reached
+ */
+template <typename Heuristic>
+int aStarFresh(const CsrGraph& graph, int start, int goal, Heuristic heuristic) {
+    int n = graph.numVertices();
+    vector<bool> visited(n, false);
+    vector<int> cost(n, INT_MAX);
+    priority_queue<Node, vector<Node>, greater<Node>> pq;
+    pq.push({start, 0, heuristic(start)});
+    cost[start] = 0;
+    while (!pq.empty()) {
+        Node current = pq.top();
+        pq.pop();
+        int node = current.id;
+        if (visited[node]) continue;
+        visited[node] = true;
+        if (node == goal) return current.g;
+        for (auto [neighbor, weight] : graph.edges(node)) {
+            int newG = current.g + weight;
+            if (newG < cost[neighbor]) {
+                cost[neighbor] = newG;
+                pq.push({neighbor, newG, newG + heuristic(neighbor)});
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * Quiet A* on a reusable workspace
+ */
+template <typename Heuristic>
+int aStarWorkspace(const CsrGraph& graph, int start, int goal, Heuristic heuristic, SearchWorkspace& ws) {
+    ws.begin(graph.numVertices());
+    priority_queue<Node, vector<Node>, greater<Node>> pq;
+    pq.push({start, 0, heuristic(start)});
+    ws.setCost(start, 0);
+    while (!pq.empty()) {
+        Node current = pq.top();
+        pq.pop();
+        int node = current.id;
+        if (ws.visited(node)) continue;
+        ws.markVisited(node);
+        if (node == goal) return current.g;
+        for (auto [neighbor, weight] : graph.edges(node)) {
+            int newG = current.g + weight;
+            if (newG < ws.cost(neighbor)) {
+                ws.setCost(neighbor, newG);
+                pq.push({neighbor, newG, newG + heuristic(neighbor)});
+            }
+        }
+    }
+    return -1;
+}
+
+// Depth-limited search with fresh visited flags
+bool dls(int node, int target, int depth, const CsrGraph& graph, vector<bool>& visited) {
+    if (depth < 0) return false;
+    if (node == target) return true;
+    visited[node] = true;
+    for (int neighbor : graph.neighbors(node)) {
+        if (!visited[neighbor] && dls(neighbor, target, depth - 1, graph, visited)) return true;
+    }
+    return false;
+}
+
+// Depth-limited search on a reusable workspace
+bool dls(int node, int target, int depth, const CsrGraph& graph, SearchWorkspace& ws) {
+    if (depth < 0) return false;
+    if (node == target) return true;
+    ws.markVisited(node);
+    for (int neighbor : graph.neighbors(node)) {
+        if (!ws.visited(neighbor) && dls(neighbor, target, depth - 1, graph, ws)) return true;
+    }
+    return false;
+}
+
+bool iddfsFresh(const CsrGraph& graph, int start, int target, int maxDepth) {
+    for (int depth = 0; depth <= maxDepth; ++depth) {
+        vector<bool> visited(graph.numVertices(), false);
+        if (dls(start, target, depth, graph, visited)) return true;
+    }
+    return false;
+}
+
+bool iddfsWorkspace(const CsrGraph& graph, int start, int target, int maxDepth, SearchWorkspace& ws) {
+    for (int depth = 0; depth <= maxDepth; ++depth) {
+        ws.begin(graph.numVertices());
+        if (dls(start, target, depth, graph, ws)) return true;
+    }
+    return false;
+}
+
+// Wall time of one call, in milliseconds
+template <typename Work>
+double timeMs(Work work) {
+    auto start = chrono::steady_clock::now();
+    work();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000;
+}
+
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 3000;
+    int queries = argc > 2 ? atoi(argv[2]) : 200;
+
+    GeneratedGraph grid = generateGrid(side, side, 1, 0.2, 10, 7);
+    const CsrGraph& graph = grid.graph;
+    cout << "Grid: " << graph.numVertices() << " vertices, " << graph.numEdges() << " edges, "
+         << queries << " queries\n";
+
+    // Manhattan distance to the query's goal, computed on demand (a full h(n) array would be O(V) per query)
+    auto manhattanTo = [&](int goal) {
+        return [&grid, goal](int v) {
+            return abs(grid.coords[2 * v] - grid.coords[2 * goal]) + abs(grid.coords[2 * v + 1] - grid.coords[2 * goal + 1]);
+        };
+    };
+
+    // Queries: open start cell, goal 8 hops away
+    mt19937 rng(42);
+    vector<int> starts, goals;
+    while ((int)starts.size() < queries) {
+        int start = rng() % graph.numVertices();
+        if (graph.degree(start) == 0) continue;
+        starts.push_back(start);
+        goals.push_back(farthestVertex(graph, start, 8));
+    }
+
+    SearchWorkspace& ws = SearchWorkspace::forThread();
+    int mismatches = 0;
+    for (int q = 0; q < queries; q++) {
+        if (aStarFresh(graph, starts[q], goals[q], manhattanTo(goals[q])) !=
+            aStarWorkspace(graph, starts[q], goals[q], manhattanTo(goals[q]), ws)) mismatches++;
+        if (iddfsFresh(graph, starts[q], goals[q], 12) != iddfsWorkspace(graph, starts[q], goals[q], 12, ws)) mismatches++;
+    }
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    volatile long long sink = 0;
+    double aFresh = timeMs([&] { for (int q = 0; q < queries; q++) sink += aStarFresh(graph, starts[q], goals[q], manhattanTo(goals[q])); });
+    double aReuse = timeMs([&] { for (int q = 0; q < queries; q++) sink += aStarWorkspace(graph, starts[q], goals[q], manhattanTo(goals[q]), ws); });
+    double iFresh = timeMs([&] { for (int q = 0; q < queries; q++) sink += iddfsFresh(graph, starts[q], goals[q], 12); });
+    double iReuse = timeMs([&] { for (int q = 0; q < queries; q++) sink += iddfsWorkspace(graph, starts[q], goals[q], 12, ws); });
+
+    cout << "  A*    fresh arrays: " << aFresh / queries << " ms/query, workspace: " << aReuse / queries
+         << " ms/query (" << aFresh / aReuse << "x)\n";
+    cout << "  IDDFS fresh arrays: " << iFresh / queries << " ms/query, workspace: " << iReuse / queries
+         << " ms/query (" << iFresh / iReuse << "x)\n";
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+/*
+ * ARRAY SEARCHES (LINEAR SEARCH, BINARY SEARCH)
+ *
+ * The two array searches of this repository as header-only functions, shared by the demo
+ * programs and the benchmarks instead of being copied into each of them:
+ *
+ *   int i = linearSearch(arr, size, target);   // linear_search.cpp, any order
+ *   int j = binarySearch(arr, size, target);   // binary_search.cpp, arr sorted ascending
+ *
+ * Both return the index of target, or -1 if it is not in the array. linearSearch returns the
+ * lowest matching index (the reference for the parallel, SIMD and multi-target searches);
+ * binarySearch returns any matching index if target occurs more than once.
+ */
+
+#ifndef ARRAY_SEARCH_H
+#define ARRAY_SEARCH_H
+
+/**
+ * Linear Search Function
+ *
+ * @param arr[] - input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @return index of target if found, -1 if not found
+ */
+inline int linearSearch(const int arr[], int size, int target) {
+    // Iterate through each element in the array
+    for (int i = 0; i < size; i++) {
+        if (arr[i] == target) {
+            return i; // Found: return the index of target
+        }
+    }
+    return -1; // Not found: return -1
+}
+
+/**
+ * Binary Search Function
+ *
+ * @param arr[] - sorted input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @param probes - if not null, incremented for every element compared (benchmarks)
+ * @return index of target if found, -1 if not found
+ */
+inline int binarySearch(const int arr[], int size, int target, long long* probes = nullptr) {
+    int left = 0;
+    int right = size - 1;
+
+    while (left <= right) {
+        // Calculate middle point (prevents integer overflow)
+        int mid = left + (right - left) / 2;
+        if (probes) ++*probes;
+
+        if (arr[mid] == target) {
+            return mid; // Found: return the index
+        } else if (arr[mid] < target) {
+            left = mid + 1; // Target is in right half
+        } else {
+            right = mid - 1; // Target is in left half
+        }
+    }
+
+    return -1; // Not found: return -1
+}
+
+#endif // ARRAY_SEARCH_H
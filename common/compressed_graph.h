@@ -0,0 +1,210 @@
+/*
+ * COMPRESSED ADJACENCY GRAPH (DELTA + VARINT)
+ *
+ * Read-only graph for graphs that do not fit in memory as CsrGraph. Each neighbor list is
+ * sorted and stored as gaps between consecutive neighbors, written as variable-length
+ * integers (LEB128: 7 bits per byte, high bit = "more bytes follow"):
+ *
+ *   list of v:  zigzag(first - v), gap, gap, ...     gap = next neighbor - previous neighbor
+ *   weighted:   each entry is followed by its weight as a varint
+ *
+ * Small gaps take one byte instead of four. Gaps are small when neighbors have nearby ids,
+ * so compress AFTER reordering the graph (graph_reorder.h): BFS / RCM ids give 1-byte gaps
+ * on road-like graphs.
+ *
+ * Lists are decoded on the fly while iterating; the graph is never decompressed as a whole.
+ * The interface matches CsrGraph (numVertices, neighbors, edges), so traversals written as
+ * templates run on either representation:
+ *   CompressedGraph small = CompressedGraph::fromCsr(reorderGraph(graph, ORDER_RCM).graph);
+ *   for (int neighbor : small.neighbors(v)) { ... }
+ *
+ * Every list is prefixed with its length in bytes (varint). Only every 16th vertex has a stored
+ * 64-bit start offset; the lists in between are reached by skipping the length prefixes.
+ * Offsets therefore cost about 1.5 bytes per vertex (CSR: 4), and the byte stream may exceed 4 GB.
+ */
+
+#ifndef COMPRESSED_GRAPH_H
+#define COMPRESSED_GRAPH_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include "csr_graph.h"
+
+class CompressedGraph {
+public:
+    // Marks the end of a decoded range
+    struct Sentinel {};
+
+    // Decodes one list entry per step; yields neighbor ids, or (neighbor, weight) pairs
+    template <bool WithWeights>
+    struct Iterator {
+        const uint8_t* next;  // First byte not decoded yet
+        const uint8_t* last;  // End of the list
+        bool hasWeights;      // Graph stores weights after each entry
+        bool valid;           // Points at an entry (false = end reached)
+        long long neighbor;   // Current neighbor (starts as the owning vertex)
+        int weight;           // Current weight (1 if unweighted)
+
+        Iterator(const uint8_t* first, const uint8_t* end, bool weighted, int vertex)
+            : next(first), last(end), hasWeights(weighted), valid(false), neighbor(vertex), weight(1) {
+            if (next < last) {
+                neighbor += unzigzag(readVarint(next));  // First entry: signed offset from the vertex
+                readWeight();
+                valid = true;
+            }
+        }
+
+        auto operator*() const {
+            if constexpr (WithWeights) return std::pair<int, int>((int)neighbor, weight);
+            else return (int)neighbor;
+        }
+
+        Iterator& operator++() {
+            valid = next < last;
+            if (valid) {
+                neighbor += readVarint(next);  // Later entries: gap to the previous neighbor
+                readWeight();
+            }
+            return *this;
+        }
+
+        bool operator!=(Sentinel) const { return valid; }
+
+    private:
+        void readWeight() {
+            if (hasWeights) weight = (int)readVarint(next);
+        }
+    };
+
+    template <bool WithWeights>
+    struct Range {
+        Iterator<WithWeights> first;
+        Iterator<WithWeights> begin() const { return first; }
+        Sentinel end() const { return {}; }
+    };
+
+    int numVertices() const { return vertexCount; }
+    long long numEdges() const { return edgeCount; }
+    bool weighted() const { return hasWeights; }
+
+    Range<false> neighbors(int v) const {
+        const uint8_t* last;
+        const uint8_t* first = list(v, last);
+        return {Iterator<false>(first, last, hasWeights, v)};
+    }
+
+    Range<true> edges(int v) const {
+        const uint8_t* last;
+        const uint8_t* first = list(v, last);
+        return {Iterator<true>(first, last, hasWeights, v)};
+    }
+
+    // Heap memory used by the graph
+    size_t memoryBytes() const {
+        return bytes.capacity() + blockBase.capacity() * sizeof(uint64_t);
+    }
+
+    /**
+     * Start an empty graph; add vertices 0, 1, 2, ... in order with appendVertex()
+     *
+     * @param weighted - store a weight after every neighbor
+     */
+    explicit CompressedGraph(bool weighted = false) : hasWeights(weighted) {}
+
+    /**
+     * Append the next vertex (id numVertices()) with its outgoing edges
+     *
+     * Streams: only the compressed bytes are kept, so a graph larger than memory as CSR
+     * can be built one vertex at a time.
+     *
+     * @param list - (neighbor, weight) pairs in any order; sorted in place
+     */
+    void appendVertex(std::vector<std::pair<int, int>>& list) {
+        std::sort(list.begin(), list.end());
+        encoded.clear();
+        long long previous = vertexCount;
+        bool first = true;
+        for (const auto& [neighbor, weight] : list) {
+            if (first) writeVarint(encoded, zigzag(neighbor - previous));
+            else writeVarint(encoded, neighbor - previous);
+            if (hasWeights) writeVarint(encoded, (uint32_t)weight);
+            previous = neighbor;
+            first = false;
+        }
+
+        if (vertexCount % BLOCK == 0) blockBase.push_back(bytes.size());
+        writeVarint(bytes, encoded.size());  // Length prefix lets lookups skip this list
+        bytes.insert(bytes.end(), encoded.begin(), encoded.end());
+        edgeCount += list.size();
+        vertexCount++;
+    }
+
+    /**
+     * Compress a CSR graph (weights are kept if it has any)
+     */
+    static CompressedGraph fromCsr(const CsrGraph& graph) {
+        CompressedGraph compressed(graph.weighted());
+        std::vector<std::pair<int, int>> list;
+        for (int v = 0; v < graph.numVertices(); v++) {
+            list.clear();
+            for (auto edge : graph.edges(v)) list.push_back(edge);
+            compressed.appendVertex(list);
+        }
+        compressed.bytes.shrink_to_fit();
+        compressed.encoded.shrink_to_fit();
+        return compressed;
+    }
+
+private:
+    static const int BLOCK = 16;  // Vertices per stored start offset
+
+    static uint64_t zigzag(long long x) { return ((uint64_t)x << 1) ^ (uint64_t)(x >> 63); }
+    static long long unzigzag(uint64_t x) { return (long long)(x >> 1) ^ -(long long)(x & 1); }
+
+    static uint64_t readVarint(const uint8_t*& p) {
+        uint64_t value = *p++;
+        if (value < 0x80) return value;  // Fast path: one-byte gap
+        value &= 0x7F;
+        for (int shift = 7;; shift += 7) {
+            uint8_t byte = *p++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (byte < 0x80) return value;
+        }
+    }
+
+    static void writeVarint(std::vector<uint8_t>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+
+    /**
+     * Locate the encoded list of v: jump to its block, skip the lists before it
+     *
+     * @param last - receives the end of the list
+     * @return first byte of the list
+     */
+    const uint8_t* list(int v, const uint8_t*& last) const {
+        const uint8_t* p = bytes.data() + blockBase[v / BLOCK];
+        for (int skip = v % BLOCK; skip > 0; skip--) {
+            uint64_t length = readVarint(p);
+            p += length;
+        }
+        uint64_t length = readVarint(p);
+        last = p + length;
+        return p;
+    }
+
+    bool hasWeights;
+    int vertexCount = 0;
+    long long edgeCount = 0;
+    std::vector<uint8_t> bytes;       // Length-prefixed encoded lists, vertex after vertex
+    std::vector<uint64_t> blockBase;  // Start of every block of BLOCK vertices
+    std::vector<uint8_t> encoded;     // appendVertex() scratch buffer
+};
+
+#endif // COMPRESSED_GRAPH_H
@@ -0,0 +1,222 @@
+/*
+ * COMPRESSED SPARSE ROW (CSR) GRAPH
+ *
+ * Shared graph representation used by the graph search algorithms in this repository
+ * (BFS, DFS, UCS, IDS, A*, Greedy Best-First, Bidirectional, IDA*).
+ *
+ * Layout:
+ * - offsets[v] .. offsets[v + 1] - range of v's edges (size V + 1)
+ * - targets[e]                   - destination of edge e (size E), contiguous for all vertices
+ * - weights[e]                   - cost of edge e (size E), separate array (structure of arrays);
+ *                                  empty for unweighted graphs
+ *
+ * Compared with vector<vector<int>> (one heap allocation per vertex), a CSR graph uses three
+ * allocations in total, and scanning the neighbors of consecutive vertices reads memory
+ * sequentially instead of chasing a pointer per vertex.
+ *
+ * Usage:
+ *   CsrGraph g = CsrGraph::fromEdges(n, {{0, 1}, {1, 2}});            // unweighted
+ *   CsrGraph w = CsrGraph::fromWeightedEdges(n, {{0, 1, 5}});         // weighted
+ *   for (int neighbor : g.neighbors(v)) { ... }
+ *   for (auto [neighbor, weight] : w.edges(v)) { ... }
+ *
+ * The arrays are immutable and shared: copying a CsrGraph is cheap, and a graph can also wrap
+ * arrays it does not own (fromArrays), such as a memory-mapped graph file (graph_file.h).
+ *
+ * Limits: up to 2^31 - 1 vertices and edges (int indexes).
+ */
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <vector>
+#include <utility>
+#include <memory>
+
+// Weighted edge for the edge-list builder
+struct WeightedEdge {
+    int from;
+    int to;
+    int weight;
+};
+
+struct CsrGraph {
+    // Range of a vertex's neighbor ids, usable in range-for loops
+    struct NeighborRange {
+        const int* first;
+        const int* last;
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+        int size() const { return last - first; }
+    };
+
+    // Iterator over (neighbor, weight) pairs; unweighted graphs report weight 1
+    struct EdgeIterator {
+        const int* target;
+        const int* weight;
+        std::pair<int, int> operator*() const { return {*target, weight ? *weight : 1}; }
+        EdgeIterator& operator++() {
+            ++target;
+            if (weight) ++weight;
+            return *this;
+        }
+        bool operator!=(const EdgeIterator& other) const { return target != other.target; }
+    };
+
+    struct EdgeRange {
+        EdgeIterator first;
+        EdgeIterator last;
+        EdgeIterator begin() const { return first; }
+        EdgeIterator end() const { return last; }
+    };
+
+    int numVertices() const { return vertexCount; }
+    int numEdges() const { return edgeCount; }
+    bool weighted() const { return weightArray != nullptr; }
+    int degree(int v) const { return offsetArray[v + 1] - offsetArray[v]; }
+
+    NeighborRange neighbors(int v) const {
+        return {targetArray + offsetArray[v], targetArray + offsetArray[v + 1]};
+    }
+
+    EdgeRange edges(int v) const {
+        const int* w = weightArray;
+        int b = offsetArray[v], e = offsetArray[v + 1];
+        return {{targetArray + b, w ? w + b : nullptr}, {targetArray + e, w ? w + e : nullptr}};
+    }
+
+    // Raw arrays (offsets: V + 1 entries, targets/weights: E entries, weights may be null)
+    const int* offsetData() const { return offsetArray; }
+    const int* targetData() const { return targetArray; }
+    const int* weightData() const { return weightArray; }
+
+    /**
+     * Wrap arrays owned by someone else (for example a memory-mapped file)
+     *
+     * @param n - number of vertices
+     * @param offsets - V + 1 edge offsets
+     * @param targets - edge destinations
+     * @param weights - edge costs, or nullptr for an unweighted graph
+     * @param owner - kept alive as long as any copy of the graph exists
+     */
+    static CsrGraph fromArrays(int n, const int* offsets, const int* targets, const int* weights,
+                               std::shared_ptr<const void> owner) {
+        CsrGraph g;
+        g.vertexCount = n;
+        g.edgeCount = n > 0 ? offsets[n] : 0;
+        g.offsetArray = offsets;
+        g.targetArray = targets;
+        g.weightArray = weights;
+        g.storage = std::move(owner);
+        return g;
+    }
+
+    /**
+     * Take ownership of freshly built arrays (weights empty = unweighted)
+     */
+    static CsrGraph fromVectors(std::vector<int> offsets, std::vector<int> targets, std::vector<int> weights) {
+        auto owned = std::make_shared<Storage>();
+        owned->offsets = std::move(offsets);
+        owned->targets = std::move(targets);
+        owned->weights = std::move(weights);
+        const Storage& s = *owned;
+        return fromArrays((int)s.offsets.size() - 1, s.offsets.data(), s.targets.data(),
+                          s.weights.empty() ? nullptr : s.weights.data(), std::move(owned));
+    }
+
+    /**
+     * Build from an unweighted edge list (counting sort by source, input order kept per vertex)
+     *
+     * @param n - number of vertices
+     * @param edges - (from, to) pairs
+     * @param undirected - also add the reverse of every edge
+     */
+    static CsrGraph fromEdges(int n, const std::vector<std::pair<int, int>>& edges, bool undirected = false) {
+        std::vector<int> offsets(n + 1, 0);
+        for (const auto& [from, to] : edges) {
+            offsets[from + 1]++;
+            if (undirected) offsets[to + 1]++;
+        }
+        for (int v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+
+        std::vector<int> targets(offsets[n]);
+        std::vector<int> fill(offsets.begin(), offsets.end() - 1);  // Next free slot per vertex
+        for (const auto& [from, to] : edges) {
+            targets[fill[from]++] = to;
+            if (undirected) targets[fill[to]++] = from;
+        }
+        return fromVectors(std::move(offsets), std::move(targets), {});
+    }
+
+    /**
+     * Build from a weighted edge list (counting sort by source, input order kept per vertex)
+     *
+     * @param n - number of vertices
+     * @param edges - (from, to, weight) triples
+     * @param undirected - also add the reverse of every edge
+     */
+    static CsrGraph fromWeightedEdges(int n, const std::vector<WeightedEdge>& edges, bool undirected = false) {
+        std::vector<int> offsets(n + 1, 0);
+        for (const WeightedEdge& e : edges) {
+            offsets[e.from + 1]++;
+            if (undirected) offsets[e.to + 1]++;
+        }
+        for (int v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+
+        std::vector<int> targets(offsets[n]), weights(offsets[n]);
+        std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+        for (const WeightedEdge& e : edges) {
+            int slot = fill[e.from]++;
+            targets[slot] = e.to;
+            weights[slot] = e.weight;
+            if (undirected) {
+                slot = fill[e.to]++;
+                targets[slot] = e.from;
+                weights[slot] = e.weight;
+            }
+        }
+        return fromVectors(std::move(offsets), std::move(targets), std::move(weights));
+    }
+
+    /**
+     * Build from an unweighted adjacency list (graph[v] = neighbors of v)
+     */
+    static CsrGraph fromAdjacencyList(const std::vector<std::vector<int>>& adjacency) {
+        std::vector<int> offsets = {0}, targets;
+        for (const auto& list : adjacency) {
+            targets.insert(targets.end(), list.begin(), list.end());
+            offsets.push_back(targets.size());
+        }
+        return fromVectors(std::move(offsets), std::move(targets), {});
+    }
+
+    /**
+     * Build from a weighted adjacency list (graph[v] = {destination, cost} pairs)
+     */
+    static CsrGraph fromAdjacencyList(const std::vector<std::vector<std::pair<int, int>>>& adjacency) {
+        std::vector<int> offsets = {0}, targets, weights;
+        for (const auto& list : adjacency) {
+            for (const auto& [to, weight] : list) {
+                targets.push_back(to);
+                weights.push_back(weight);
+            }
+            offsets.push_back(targets.size());
+        }
+        return fromVectors(std::move(offsets), std::move(targets), std::move(weights));
+    }
+
+private:
+    // Arrays owned by the graph itself (builders)
+    struct Storage {
+        std::vector<int> offsets, targets, weights;
+    };
+
+    int vertexCount = 0;
+    int edgeCount = 0;
+    const int* offsetArray = nullptr;
+    const int* targetArray = nullptr;
+    const int* weightArray = nullptr;
+    std::shared_ptr<const void> storage;  // Keeps the arrays alive; copies share it
+};
+
+#endif // CSR_GRAPH_H
@@ -0,0 +1,224 @@
+/*
+ * ITERATIVE DEPTH-FIRST SEARCH ENGINE
+ *
+ * Depth-first traversal with an explicit stack instead of recursion. A recursive DFS uses one
+ * native stack frame (return address, saved registers, locals: 50-100 bytes) per vertex on the
+ * current path and crashes once a path is a few hundred thousand vertices long; this engine
+ * keeps the path in a contiguous vector of small frames:
+ *
+ *   frame = (vertex, position in its neighbor list)     CsrGraph: 8 bytes (two ints)
+ *
+ * so a path of millions of vertices costs a few megabytes of heap, and walking it stays in cache.
+ * Vertices are visited in exactly the same order as the recursive version.
+ *
+ * Hooks (any callables):
+ *   enter(v, parent, depth) -> DfsStep     pre-order: called for the start vertex (parent -1) and
+ *                                          for every edge parent -> v; return
+ *                                            DFS_ENTER - push v and explore its neighbors
+ *                                            DFS_SKIP  - ignore this edge (visited, too deep, ...)
+ *                                            DFS_STOP  - end the whole traversal
+ *   leave(v, parent, depth)                post-order: all of v's neighbors are done
+ *
+ * The engine keeps no visited set of its own: enter() decides, so callers can use a
+ * vector<bool>, a SearchWorkspace or a depth limit.
+ *
+ *   DfsEngine<CsrGraph> engine(graph);
+ *   engine.run(start,
+ *              [&](int v, int, int) { if (visited[v]) return DFS_SKIP; visited[v] = true; return DFS_ENTER; },
+ *              [&](int v, int, int) { postOrder.push_back(v); });
+ *
+ * Built on the engine: topologicalOrder() and stronglyConnectedComponents() (Tarjan).
+ */
+
+#ifndef DFS_ENGINE_H
+#define DFS_ENGINE_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include "csr_graph.h"
+
+enum DfsStep {
+    DFS_ENTER,
+    DFS_SKIP,
+    DFS_STOP
+};
+
+/**
+ * Position inside one vertex's neighbor list (generic graphs: keeps the range's iterator and end)
+ */
+template <typename Graph>
+struct NeighborCursor {
+    using Range = decltype(std::declval<const Graph&>().neighbors(0));
+    using Iterator = decltype(std::declval<Range>().begin());
+    using End = decltype(std::declval<Range>().end());
+
+    Iterator next;
+    End last;
+
+    NeighborCursor(const Graph& graph, int v) : NeighborCursor(graph.neighbors(v)) {}
+    explicit NeighborCursor(const Range& range) : next(range.begin()), last(range.end()) {}
+
+    bool done(const Graph&, int) const { return !(next != last); }
+    int advance(const Graph&) {
+        int neighbor = *next;
+        ++next;
+        return neighbor;
+    }
+};
+
+/**
+ * CSR specialization: the position is one absolute edge index, the end is read from the offsets
+ */
+template <>
+struct NeighborCursor<CsrGraph> {
+    int edge;
+
+    NeighborCursor(const CsrGraph& graph, int v) : edge(graph.offsetData()[v]) {}
+
+    bool done(const CsrGraph& graph, int v) const { return edge == graph.offsetData()[v + 1]; }
+    int advance(const CsrGraph& graph) { return graph.targetData()[edge++]; }
+};
+
+template <typename Graph>
+class DfsEngine {
+public:
+    // One vertex of the current path
+    struct Frame {
+        int vertex;
+        NeighborCursor<Graph> cursor;
+    };
+
+    explicit DfsEngine(const Graph& g) : graph(g) {}
+
+    /**
+     * Depth-first traversal from start
+     *
+     * @param enter - pre-order hook, decides whether to descend (see file comment)
+     * @param leave - post-order hook
+     * @return false if enter() returned DFS_STOP, true if the traversal finished
+     */
+    template <typename Enter, typename Leave>
+    bool run(int start, Enter enter, Leave leave) {
+        stack.clear();
+        DfsStep step = enter(start, -1, 0);
+        if (step == DFS_STOP) return false;
+        if (step == DFS_SKIP) return true;
+        stack.push_back({start, NeighborCursor<Graph>(graph, start)});
+
+        while (!stack.empty()) {
+            Frame& top = stack.back();
+            int depth = stack.size() - 1;
+            if (top.cursor.done(graph, top.vertex)) {
+                int v = top.vertex;
+                stack.pop_back();
+                leave(v, stack.empty() ? -1 : stack.back().vertex, depth);
+                continue;
+            }
+            int neighbor = top.cursor.advance(graph);
+            step = enter(neighbor, top.vertex, depth + 1);
+            if (step == DFS_STOP) return false;
+            if (step == DFS_ENTER) stack.push_back({neighbor, NeighborCursor<Graph>(graph, neighbor)});
+            // top may dangle after push_back; it is re-read at the start of the next iteration
+        }
+        return true;
+    }
+
+    /**
+     * Traversal without a post-order hook
+     */
+    template <typename Enter>
+    bool run(int start, Enter enter) {
+        return run(start, enter, [](int, int, int) {});
+    }
+
+    // Current path, start vertex first (valid inside the hooks)
+    const std::vector<Frame>& path() const { return stack; }
+
+private:
+    const Graph& graph;
+    std::vector<Frame> stack;  // Kept between runs so its capacity is reused
+};
+
+/**
+ * Topological order of a directed acyclic graph (reverse DFS post-order over all vertices)
+ *
+ * @param order - receives the vertices, every edge u -> v has u before v
+ * @return false if the graph has a cycle (order is then incomplete)
+ */
+template <typename Graph>
+bool topologicalOrder(const Graph& graph, std::vector<int>& order) {
+    enum { WHITE, GRAY, BLACK };  // Unvisited, on the current path, finished
+    int n = graph.numVertices();
+    std::vector<unsigned char> color(n, WHITE);
+    order.clear();
+    order.reserve(n);
+    DfsEngine<Graph> engine(graph);
+
+    for (int root = 0; root < n; root++) {
+        if (color[root] != WHITE) continue;
+        bool acyclic = engine.run(root,
+            [&](int v, int, int) {
+                if (color[v] == GRAY) return DFS_STOP;  // Edge back into the current path: cycle
+                if (color[v] == BLACK) return DFS_SKIP;
+                color[v] = GRAY;
+                return DFS_ENTER;
+            },
+            [&](int v, int, int) {
+                color[v] = BLACK;
+                order.push_back(v);
+            });
+        if (!acyclic) return false;
+    }
+    std::reverse(order.begin(), order.end());
+    return true;
+}
+
+/**
+ * Strongly connected components (Tarjan's algorithm on the iterative engine)
+ *
+ * @param component - receives component ids; ids are in reverse topological order of the
+ *                    component graph (an edge between components goes from a higher id to a lower)
+ * @return number of components
+ */
+template <typename Graph>
+int stronglyConnectedComponents(const Graph& graph, std::vector<int>& component) {
+    int n = graph.numVertices();
+    std::vector<int> index(n, -1), low(n);
+    std::vector<int> open;           // Tarjan's stack: visited vertices without a component yet
+    std::vector<bool> onOpen(n, false);
+    component.assign(n, -1);
+    int nextIndex = 0, count = 0;
+    DfsEngine<Graph> engine(graph);
+
+    for (int root = 0; root < n; root++) {
+        if (index[root] != -1) continue;
+        engine.run(root,
+            [&](int v, int parent, int) {
+                if (index[v] != -1) {
+                    if (onOpen[v]) low[parent] = std::min(low[parent], index[v]);  // Edge inside a component
+                    return DFS_SKIP;
+                }
+                index[v] = low[v] = nextIndex++;
+                open.push_back(v);
+                onOpen[v] = true;
+                return DFS_ENTER;
+            },
+            [&](int v, int parent, int) {
+                if (low[v] == index[v]) {  // v is the root of a component: pop it
+                    int w;
+                    do {
+                        w = open.back();
+                        open.pop_back();
+                        onOpen[w] = false;
+                        component[w] = count;
+                    } while (w != v);
+                    count++;
+                }
+                if (parent >= 0) low[parent] = std::min(low[parent], low[v]);
+            });
+    }
+    return count;
+}
+
+#endif // DFS_ENGINE_H
@@ -0,0 +1,419 @@
+/*
+ * GRAPH FILES: BINARY CSR FORMAT AND TEXT EDGE-LIST IMPORTER
+ *
+ * Loads large graphs (road networks, social graphs) into the CsrGraph used by every graph
+ * search in this repository.
+ *
+ * 1. Binary graph file (".csr"): the CSR arrays exactly as they lie in memory
+ *    - 64-byte header, then offsets / targets / weights / heuristic sections, each 64-byte aligned
+ *    - mapGraphFile() maps the file with mmap() and points a CsrGraph at it: no read, no parse,
+ *      no copy. Pages are loaded by the OS on first touch, so opening takes milliseconds
+ *      whatever the graph size
+ *    - Optional per-vertex heuristic column (h(n) for A*, Greedy Best-First, IDA*)
+ *
+ * 2. Text importer (importEdgeList): parses edge lists in parallel, one byte range per thread
+ *    - Plain edge lists: "from to [weight]" per line, 0-based ids, '#' or '%' comments (SNAP)
+ *    - DIMACS shortest-path files: "p sp n m", "a from to weight" with 1-based ids, 'c' comments
+ *    - Hand-written number parser on the mapped text (no iostreams, no per-line allocation)
+ *
+ * Usage:
+ *   CsrGraph g;
+ *   importEdgeList("USA-road-d.NY.gr", g);        // slow path, once
+ *   writeGraphFile("ny.csr", g);
+ *   GraphFile file;
+ *   mapGraphFile("ny.csr", file);                 // fast path, every run
+ *   mapGraphFile("download.csr", file, true);     // untrusted file: also check every offset and target
+ *   bfs(0, file.graph);
+ *
+ * Errors are printed to std::cerr and reported by a false return value.
+ * POSIX only (mmap).
+ */
+
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "csr_graph.h"
+
+const char GRAPH_FILE_MAGIC[8] = {'C', 'S', 'R', 'G', 'R', 'P', 'H', '1'};
+const uint32_t GRAPH_FILE_VERSION = 1;
+const uint32_t GRAPH_FILE_WEIGHTED = 1;   // Header flag: weights section present
+const uint32_t GRAPH_FILE_HEURISTIC = 2;  // Header flag: heuristic section present
+const uint64_t GRAPH_FILE_ALIGNMENT = 64; // Every section starts on a cache line
+
+/**
+ * File header (64 bytes, at offset 0). All arrays are int32 in the host byte order.
+ */
+struct GraphFileHeader {
+    char magic[8];             // "CSRGRPH1"
+    uint32_t version;          // GRAPH_FILE_VERSION
+    uint32_t flags;            // GRAPH_FILE_WEIGHTED | GRAPH_FILE_HEURISTIC
+    uint64_t numVertices;      // V
+    uint64_t numEdges;         // E
+    uint64_t offsetsOffset;    // Byte offset of offsets[V + 1]
+    uint64_t targetsOffset;    // Byte offset of targets[E]
+    uint64_t weightsOffset;    // Byte offset of weights[E], 0 = unweighted
+    uint64_t heuristicOffset;  // Byte offset of heuristic[V], 0 = none
+};
+static_assert(sizeof(GraphFileHeader) == 64, "header must stay 64 bytes");
+
+inline uint64_t graphFileAlign(uint64_t value) {
+    return (value + GRAPH_FILE_ALIGNMENT - 1) / GRAPH_FILE_ALIGNMENT * GRAPH_FILE_ALIGNMENT;
+}
+
+/**
+ * Write a graph (and optionally a heuristic column) in the binary format
+ *
+ * @param path - output file
+ * @param graph - graph to store
+ * @param heuristic - numVertices() values, or nullptr
+ * @return true on success
+ */
+inline bool writeGraphFile(const char* path, const CsrGraph& graph, const int* heuristic = nullptr) {
+    uint64_t n = graph.numVertices(), m = graph.numEdges();
+
+    GraphFileHeader header = {};
+    memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+    header.version = GRAPH_FILE_VERSION;
+    header.flags = (graph.weighted() ? GRAPH_FILE_WEIGHTED : 0) | (heuristic ? GRAPH_FILE_HEURISTIC : 0);
+    header.numVertices = n;
+    header.numEdges = m;
+    header.offsetsOffset = graphFileAlign(sizeof(header));
+    header.targetsOffset = graphFileAlign(header.offsetsOffset + (n + 1) * sizeof(int));
+    uint64_t end = header.targetsOffset + m * sizeof(int);
+    if (graph.weighted()) {
+        header.weightsOffset = graphFileAlign(end);
+        end = header.weightsOffset + m * sizeof(int);
+    }
+    if (heuristic) {
+        header.heuristicOffset = graphFileAlign(end);
+        end = header.heuristicOffset + n * sizeof(int);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "writeGraphFile: cannot create " << path << std::endl;
+        return false;
+    }
+    auto writeAt = [&](uint64_t offset, const void* bytes, uint64_t length) {
+        out.seekp(offset);
+        out.write(static_cast<const char*>(bytes), length);
+    };
+    const int emptyOffsets[1] = {0};
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.offsetsOffset, n > 0 ? graph.offsetData() : emptyOffsets, (n + 1) * sizeof(int));
+    writeAt(header.targetsOffset, graph.targetData(), m * sizeof(int));
+    if (graph.weighted()) writeAt(header.weightsOffset, graph.weightData(), m * sizeof(int));
+    if (heuristic) writeAt(header.heuristicOffset, heuristic, n * sizeof(int));
+    out.close();
+    if (!out) {
+        std::cerr << "writeGraphFile: write to " << path << " failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * A graph mapped from a binary graph file
+ */
+struct GraphFile {
+    CsrGraph graph;
+    const int* heuristic = nullptr;  // Per-vertex h(n), or nullptr; valid while any copy of graph lives
+};
+
+/**
+ * Map a binary graph file and validate its header (zero-copy)
+ *
+ * By default only the header and the first/last offsets are checked and the arrays themselves
+ * are trusted, so that opening never reads the whole file. With verify the offsets must also
+ * be nondecreasing and every target a vertex id: one pass over both arrays (touches every
+ * page), for files from untrusted sources.
+ *
+ * @param path - file written by writeGraphFile()
+ * @param out - receives the graph; the mapping is released when the last CsrGraph copy is gone
+ * @param verify - also check every offset and target
+ * @return true on success
+ */
+inline bool mapGraphFile(const char* path, GraphFile& out, bool verify = false) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "mapGraphFile: cannot open " << path << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (uint64_t)info.st_size < sizeof(GraphFileHeader)) {
+        std::cerr << "mapGraphFile: " << path << " is too small" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    uint64_t bytes = info.st_size;
+    void* base = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // The mapping stays valid after the descriptor is closed
+    if (base == MAP_FAILED) {
+        std::cerr << "mapGraphFile: mmap of " << path << " failed" << std::endl;
+        return false;
+    }
+    std::shared_ptr<const void> mapping(base, [bytes](const void* p) { munmap(const_cast<void*>(p), bytes); });
+    const char* data = static_cast<const char*>(base);
+
+    const GraphFileHeader* h = reinterpret_cast<const GraphFileHeader*>(data);
+    auto fits = [&](uint64_t offset, uint64_t count) {
+        return offset >= sizeof(GraphFileHeader) && offset % GRAPH_FILE_ALIGNMENT == 0 &&
+               offset <= bytes && count <= (bytes - offset) / sizeof(int);
+    };
+    const char* problem = nullptr;
+    if (memcmp(h->magic, GRAPH_FILE_MAGIC, sizeof(h->magic)) != 0) problem = "bad magic";
+    else if (h->version != GRAPH_FILE_VERSION) problem = "unsupported version";
+    else if (h->numVertices > INT_MAX - 1 || h->numEdges > INT_MAX) problem = "graph too large for int ids";
+    else if (!fits(h->offsetsOffset, h->numVertices + 1) || !fits(h->targetsOffset, h->numEdges)) problem = "arrays out of range (truncated?)";
+    else if ((h->flags & GRAPH_FILE_WEIGHTED) && !fits(h->weightsOffset, h->numEdges)) problem = "weights out of range";
+    else if ((h->flags & GRAPH_FILE_HEURISTIC) && !fits(h->heuristicOffset, h->numVertices)) problem = "heuristic out of range";
+    if (problem) {
+        std::cerr << "mapGraphFile: " << path << ": " << problem << std::endl;
+        return false;
+    }
+
+    int n = h->numVertices;
+    const int* offsets = reinterpret_cast<const int*>(data + h->offsetsOffset);
+    if (offsets[0] != 0 || (uint64_t)offsets[n] != h->numEdges) {
+        std::cerr << "mapGraphFile: " << path << ": offsets do not match the edge count" << std::endl;
+        return false;
+    }
+
+    const int* targets = reinterpret_cast<const int*>(data + h->targetsOffset);
+    if (verify) {
+        for (int v = 0; v < n; v++) {
+            if (offsets[v] > offsets[v + 1]) {
+                std::cerr << "mapGraphFile: " << path << ": offsets decrease at vertex " << v << std::endl;
+                return false;
+            }
+        }
+        for (uint64_t e = 0; e < h->numEdges; e++) {
+            if (targets[e] < 0 || targets[e] >= n) {
+                std::cerr << "mapGraphFile: " << path << ": edge " << e << " targets invalid vertex " << targets[e] << std::endl;
+                return false;
+            }
+        }
+    }
+    const int* weights = (h->flags & GRAPH_FILE_WEIGHTED) ? reinterpret_cast<const int*>(data + h->weightsOffset) : nullptr;
+    out.heuristic = (h->flags & GRAPH_FILE_HEURISTIC) ? reinterpret_cast<const int*>(data + h->heuristicOffset) : nullptr;
+    out.graph = CsrGraph::fromArrays(n, offsets, targets, weights, std::move(mapping));
+    return true;
+}
+
+/**
+ * Edges parsed by one importer thread
+ */
+struct EdgeListChunk {
+    std::vector<WeightedEdge> edges;
+    long long maxVertex = -1;         // Largest vertex id seen (0-based)
+    long long declaredVertices = -1;  // n from a DIMACS "p" line
+    bool sawWeight = false;           // Some line had a third column
+    long long errorAt = -1;           // Byte offset of the first malformed line
+};
+
+/**
+ * Parse one (optionally signed) decimal number, skipping leading blanks
+ *
+ * @return false if no digits follow
+ */
+inline bool parseEdgeListNumber(const char*& p, const char* end, long long& value) {
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    bool negative = p < end && *p == '-';
+    if (negative) p++;
+    if (p == end || *p < '0' || *p > '9') return false;
+    long long v = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        v = v * 10 + (*p - '0');
+        if (v > INT_MAX) return false;  // Ids and weights are int
+        p++;
+    }
+    value = negative ? -v : v;
+    return true;
+}
+
+/**
+ * Parse every line that STARTS inside [begin, end); a line may run past end
+ *
+ * @param text - whole file
+ * @param size - file size
+ * @param dimacs - DIMACS syntax (1-based) instead of a plain edge list
+ * @param out - parsed edges and statistics
+ */
+inline void parseEdgeListRange(const char* text, size_t size, size_t begin, size_t end, bool dimacs, EdgeListChunk& out) {
+    out.edges.reserve((end - begin) / 16);  // Rough guess of the line count: avoids most regrowth copies
+    size_t pos = begin;
+    if (pos > 0 && text[pos - 1] != '\n') {  // Partial line belongs to the previous range
+        while (pos < size && text[pos] != '\n') pos++;
+        pos++;
+    }
+
+    while (pos < end) {
+        const char* line = text + pos;
+        const char* lineEnd = static_cast<const char*>(memchr(line, '\n', size - pos));
+        if (!lineEnd) lineEnd = text + size;
+        size_t next = lineEnd - text + 1;
+
+        const char* p = line;
+        while (p < lineEnd && (*p == ' ' || *p == '\t')) p++;
+        bool blank = p == lineEnd || *p == '\r';
+        bool ok = true;
+        long long from = 0, to = 0, weight = 1;
+
+        if (blank) {
+            // Nothing on this line
+        } else if (dimacs) {
+            if (*p == 'c') {
+                // Comment
+            } else if (*p == 'p') {
+                p++;
+                while (p < lineEnd && (*p == ' ' || *p == '\t')) p++;
+                while (p < lineEnd && *p != ' ' && *p != '\t') p++;  // Problem type, e.g. "sp"
+                ok = parseEdgeListNumber(p, lineEnd, out.declaredVertices);
+            } else if (*p == 'a') {
+                p++;
+                ok = parseEdgeListNumber(p, lineEnd, from) && parseEdgeListNumber(p, lineEnd, to) &&
+                     parseEdgeListNumber(p, lineEnd, weight) && from >= 1 && to >= 1;
+                if (ok) {
+                    out.edges.push_back({(int)(from - 1), (int)(to - 1), (int)weight});
+                    out.maxVertex = std::max(out.maxVertex, std::max(from, to) - 1);
+                    out.sawWeight = true;
+                }
+            } else {
+                ok = false;
+            }
+        } else if (*p != '#' && *p != '%') {
+            ok = parseEdgeListNumber(p, lineEnd, from) && parseEdgeListNumber(p, lineEnd, to) && from >= 0 && to >= 0;
+            if (ok && parseEdgeListNumber(p, lineEnd, weight)) out.sawWeight = true;
+            if (ok) {
+                out.edges.push_back({(int)from, (int)to, (int)weight});
+                out.maxVertex = std::max(out.maxVertex, std::max(from, to));
+            }
+        }
+
+        if (!ok && out.errorAt < 0) out.errorAt = pos;
+        pos = next;
+    }
+}
+
+/**
+ * Import a text edge list or DIMACS file in parallel
+ *
+ * @param path - plain edge list or DIMACS ".gr" file (detected from the first non-blank line)
+ * @param graph - receives the graph (weighted if the file has weights)
+ * @param undirected - also add the reverse of every edge (SNAP social graphs list each edge once)
+ * @param threads - parser threads, 0 = all cores
+ * @return true on success
+ */
+inline bool importEdgeList(const char* path, CsrGraph& graph, bool undirected = false, int threads = 0) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "importEdgeList: cannot open " << path << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        std::cerr << "importEdgeList: cannot stat " << path << std::endl;
+        return false;
+    }
+    size_t size = info.st_size;
+    const char* text = nullptr;
+    if (size > 0) {
+        void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd);
+            std::cerr << "importEdgeList: mmap of " << path << " failed" << std::endl;
+            return false;
+        }
+        text = static_cast<const char*>(base);
+        madvise(base, size, MADV_SEQUENTIAL);  // Read front to back: let the kernel read ahead
+    }
+    ::close(fd);
+
+    // DIMACS files start with 'c' comments or the 'p' line
+    size_t first = 0;
+    while (first < size && (text[first] == ' ' || text[first] == '\t' || text[first] == '\r' || text[first] == '\n')) first++;
+    bool dimacs = first < size && (text[first] == 'c' || text[first] == 'p' || text[first] == 'a');
+
+    // One byte range per thread; small files use one thread
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = (int)std::max<size_t>(1, std::min<size_t>(threads, size / (1 << 20) + 1));
+    std::vector<EdgeListChunk> chunks(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        size_t begin = size / threads * t;
+        size_t end = t == threads - 1 ? size : size / threads * (t + 1);
+        workers.emplace_back(parseEdgeListRange, text, size, begin, end, dimacs, std::ref(chunks[t]));
+    }
+    for (std::thread& w : workers) w.join();
+    if (text) munmap(const_cast<char*>(text), size);
+
+    // Merge statistics and check the input
+    long long maxVertex = -1, declared = -1, edgeCount = 0;
+    bool weighted = false;
+    for (const EdgeListChunk& c : chunks) {
+        if (c.errorAt >= 0) {
+            std::cerr << "importEdgeList: " << path << ": malformed line at byte " << c.errorAt << std::endl;
+            return false;
+        }
+        maxVertex = std::max(maxVertex, c.maxVertex);
+        if (c.declaredVertices >= 0) declared = c.declaredVertices;
+        weighted = weighted || c.sawWeight;
+        edgeCount += c.edges.size();
+    }
+    long long n = dimacs && declared >= 0 ? declared : maxVertex + 1;
+    if (maxVertex >= n) {
+        std::cerr << "importEdgeList: " << path << ": vertex id " << maxVertex + 1 << " exceeds the 'p' line" << std::endl;
+        return false;
+    }
+    if (n > INT_MAX - 1 || edgeCount * (undirected ? 2 : 1) > INT_MAX) {
+        std::cerr << "importEdgeList: " << path << ": graph too large for int ids" << std::endl;
+        return false;
+    }
+
+    // Counting sort by source, chunk by chunk (keeps file order per vertex)
+    std::vector<int> offsets(n + 1, 0);
+    for (const EdgeListChunk& c : chunks) {
+        for (const WeightedEdge& e : c.edges) {
+            offsets[e.from + 1]++;
+            if (undirected) offsets[e.to + 1]++;
+        }
+    }
+    for (long long v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+
+    std::vector<int> targets(offsets[n]), weights(weighted ? offsets[n] : 0);
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (EdgeListChunk& c : chunks) {
+        for (const WeightedEdge& e : c.edges) {
+            int slot = fill[e.from]++;
+            targets[slot] = e.to;
+            if (weighted) weights[slot] = e.weight;
+            if (undirected) {
+                slot = fill[e.to]++;
+                targets[slot] = e.from;
+                if (weighted) weights[slot] = e.weight;
+            }
+        }
+        std::vector<WeightedEdge>().swap(c.edges);  // Release parsed edges as soon as they are placed
+    }
+
+    graph = CsrGraph::fromVectors(std::move(offsets), std::move(targets), std::move(weights));
+    return true;
+}
+
+#endif // GRAPH_FILE_H
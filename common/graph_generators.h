@@ -0,0 +1,283 @@
+/*
+ * SYNTHETIC GRAPH GENERATORS
+ *
+ * Reproducible (seeded) workloads for benchmarking the graph searches at sizes the hand-written
+ * example graphs cannot reach. All graphs are undirected, so Bidirectional BFS can walk edges
+ * backwards.
+ *
+ * Generators:
+ * - generateGrid      - 2D (depth = 1) or 3D grid, 4 / 6 neighbors, a fraction of cells blocked
+ *                       by obstacles, weights 1..maxWeight; heuristic = Manhattan distance
+ * - generateRmat      - R-MAT / Kronecker power-law graph (a few hubs, long degree tail), the
+ *                       Graph500 generator; no coordinates, so no heuristic
+ * - generateGeometric - random geometric "road-like" graph: points in a square, joined when
+ *                       closer than a radius; weight = rounded-up length, heuristic = rounded-down
+ *                       straight-line distance
+ *
+ * Every heuristic is consistent (h(u) <= w(u, v) + h(v)), so A* and IDA* stay optimal:
+ *   GeneratedGraph road = generateGeometric(1 << 20, 6, 42);
+ *   vector<int> h = road.heuristicTo(goal);
+ *   aStar(start, goal, road.graph, h);
+ *
+ * Blocked grid cells and unconnected points keep their vertex ids but have no edges; use
+ * largestComponentVertex() and farthestVertex() to pick query endpoints inside one component.
+ */
+
+#ifndef GRAPH_GENERATORS_H
+#define GRAPH_GENERATORS_H
+
+#include <vector>
+#include <queue>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <utility>
+#include "csr_graph.h"
+
+/**
+ * Generated graph plus the vertex coordinates its heuristic is computed from
+ */
+struct GeneratedGraph {
+    CsrGraph graph;
+    int dimensions = 0;        // Coordinates per vertex (0 = none, R-MAT)
+    bool euclidean = false;    // Straight-line distance instead of Manhattan distance
+    std::vector<int> coords;   // coords[v * dimensions + d]
+
+    bool hasHeuristic() const { return dimensions > 0; }
+
+    /**
+     * Admissible, consistent h(n) for one goal (all zeros if there are no coordinates)
+     */
+    std::vector<int> heuristicTo(int goal) const {
+        int n = graph.numVertices();
+        std::vector<int> h(n, 0);
+        if (dimensions == 0) return h;
+        const int* g = &coords[(size_t)goal * dimensions];
+        for (int v = 0; v < n; v++) {
+            const int* p = &coords[(size_t)v * dimensions];
+            if (euclidean) {
+                double dx = p[0] - g[0], dy = p[1] - g[1];
+                h[v] = (int)std::floor(std::sqrt(dx * dx + dy * dy));
+            } else {
+                int sum = 0;
+                for (int d = 0; d < dimensions; d++) sum += std::abs(p[d] - g[d]);
+                h[v] = sum;
+            }
+        }
+        return h;
+    }
+};
+
+/**
+ * 2D or 3D grid with obstacles
+ *
+ * @param width, height, depth - cells per axis (depth = 1 gives a 2D grid with 4 neighbors)
+ * @param obstacleRate - fraction of cells blocked (0.0 .. 1.0); blocked cells have no edges
+ * @param maxWeight - edge weights are uniform in 1..maxWeight (1 = every edge costs 1)
+ * @param seed - random seed
+ */
+inline GeneratedGraph generateGrid(int width, int height, int depth, double obstacleRate, int maxWeight,
+                                   unsigned seed) {
+    std::mt19937 rng(seed);
+    std::bernoulli_distribution blocked(obstacleRate);
+    int n = width * height * depth;
+    std::vector<bool> open(n);
+    for (int v = 0; v < n; v++) open[v] = !blocked(rng);
+
+    GeneratedGraph result;
+    result.dimensions = depth > 1 ? 3 : 2;
+    result.coords.resize((size_t)n * result.dimensions);
+
+    std::vector<WeightedEdge> edges;
+    edges.reserve((size_t)n * result.dimensions);
+    auto link = [&](int a, int b) {
+        if (open[a] && open[b]) edges.push_back({a, b, 1 + (int)(rng() % maxWeight)});
+    };
+    for (int z = 0; z < depth; z++) {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int cell = (z * height + y) * width + x;
+                int* p = &result.coords[(size_t)cell * result.dimensions];
+                p[0] = x;
+                p[1] = y;
+                if (depth > 1) p[2] = z;
+                if (x + 1 < width) link(cell, cell + 1);
+                if (y + 1 < height) link(cell, cell + width);
+                if (z + 1 < depth) link(cell, cell + width * height);
+            }
+        }
+    }
+    result.graph = CsrGraph::fromWeightedEdges(n, edges, true);
+    return result;
+}
+
+/**
+ * R-MAT (recursive matrix) power-law graph
+ *
+ * Each edge picks one quadrant of the adjacency matrix per bit of the vertex ids, with the
+ * Graph500 probabilities a = 0.57, b = c = 0.19, d = 0.05. Self loops are dropped; duplicate
+ * edges are kept.
+ *
+ * @param scale - 2^scale vertices
+ * @param edgeFactor - edges per vertex (before adding the reverse edges)
+ * @param maxWeight - weights uniform in 1..maxWeight; 1 builds an unweighted graph
+ * @param seed - random seed
+ */
+inline GeneratedGraph generateRmat(int scale, int edgeFactor, int maxWeight, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+
+    std::vector<WeightedEdge> edges;
+    edges.reserve(m);
+    for (long long e = 0; e < m; e++) {
+        int from = 0, to = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = unit(rng);
+            int row = r >= 0.76;                             // Quadrants c and d
+            int col = (r >= 0.57 && r < 0.76) || r >= 0.95;  // Quadrants b and d
+            from |= row << bit;
+            to |= col << bit;
+        }
+        if (from != to) edges.push_back({from, to, 1 + (int)(rng() % maxWeight)});
+    }
+
+    GeneratedGraph result;
+    if (maxWeight > 1) {
+        result.graph = CsrGraph::fromWeightedEdges(n, edges, true);
+    } else {
+        std::vector<std::pair<int, int>> pairs;
+        pairs.reserve(edges.size());
+        for (const WeightedEdge& e : edges) pairs.push_back({e.from, e.to});
+        result.graph = CsrGraph::fromEdges(n, pairs, true);
+    }
+    return result;
+}
+
+/**
+ * Random geometric graph (road-like: planar-ish, low degree, long shortest paths)
+ *
+ * Points are uniform in a SIDE x SIDE square; two points are joined when their distance is below
+ * the radius that gives the requested average degree. Neighbors are found through a bucket grid
+ * with cells one radius wide. Point ids follow bucket order, so nearby points have nearby ids
+ * (like a road network stored by region).
+ *
+ * @param n - number of points
+ * @param averageDegree - expected neighbors per point
+ * @param seed - random seed
+ */
+inline GeneratedGraph generateGeometric(int n, double averageDegree, unsigned seed) {
+    const int SIDE = 1 << 20;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coordinate(0, SIDE - 1);
+
+    double radius = SIDE * std::sqrt(averageDegree / (n * M_PI));
+    int buckets = std::max(1, (int)(SIDE / radius));
+    double bucketWidth = (double)SIDE / buckets;
+    auto bucketOf = [&](int c) { return std::min(buckets - 1, (int)(c / bucketWidth)); };
+
+    // Draw the points, then number them bucket by bucket
+    std::vector<std::pair<int, int>> points(n);
+    for (auto& p : points) p = {coordinate(rng), coordinate(rng)};
+    std::vector<long long> key(n);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) {
+        key[i] = (long long)bucketOf(points[i].second) * buckets + bucketOf(points[i].first);
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return key[a] < key[b]; });
+
+    GeneratedGraph result;
+    result.dimensions = 2;
+    result.euclidean = true;
+    result.coords.resize((size_t)n * 2);
+    std::vector<int> bucketStart((size_t)buckets * buckets + 1, 0);
+    for (int v = 0; v < n; v++) {
+        result.coords[2 * v] = points[order[v]].first;
+        result.coords[2 * v + 1] = points[order[v]].second;
+        bucketStart[key[order[v]] + 1]++;
+    }
+    for (size_t b = 0; b + 1 < bucketStart.size(); b++) bucketStart[b + 1] += bucketStart[b];
+
+    // Join each point with the later points of its own and the following neighbor buckets
+    std::vector<WeightedEdge> edges;
+    edges.reserve((size_t)(n * averageDegree / 2));
+    double radiusSquared = radius * radius;
+    for (int v = 0; v < n; v++) {
+        int x = result.coords[2 * v], y = result.coords[2 * v + 1];
+        int bx = bucketOf(x), by = bucketOf(y);
+        for (int dy = 0; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if (dy == 0 && dx < 0) continue;  // Visited from the other side
+                int nx = bx + dx, ny = by + dy;
+                if (nx < 0 || nx >= buckets || ny >= buckets) continue;
+                long long b = (long long)ny * buckets + nx;
+                for (int u = std::max(bucketStart[b], dy == 0 && dx == 0 ? v + 1 : 0); u < bucketStart[b + 1]; u++) {
+                    double ex = result.coords[2 * u] - x, ey = result.coords[2 * u + 1] - y;
+                    double d2 = ex * ex + ey * ey;
+                    if (d2 < radiusSquared) edges.push_back({v, u, std::max(1, (int)std::ceil(std::sqrt(d2)))});
+                }
+            }
+        }
+    }
+    result.graph = CsrGraph::fromWeightedEdges(n, edges, true);
+    return result;
+}
+
+/**
+ * Lowest-id vertex of the largest connected component (graph must be undirected)
+ */
+inline int largestComponentVertex(const CsrGraph& graph) {
+    int n = graph.numVertices();
+    std::vector<bool> seen(n, false);
+    std::vector<int> queue;
+    int best = 0, bestSize = 0;
+    for (int root = 0; root < n; root++) {
+        if (seen[root]) continue;
+        seen[root] = true;
+        queue.assign(1, root);
+        for (size_t head = 0; head < queue.size(); head++) {
+            for (int neighbor : graph.neighbors(queue[head])) {
+                if (!seen[neighbor]) {
+                    seen[neighbor] = true;
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+        if ((int)queue.size() > bestSize) {
+            best = root;
+            bestSize = queue.size();
+        }
+    }
+    return best;
+}
+
+/**
+ * Vertex with the largest hop distance from start (BFS), a long query inside start's component
+ *
+ * @param limit - stop at this hop distance (-1 = no limit); returns a vertex at that distance
+ */
+inline int farthestVertex(const CsrGraph& graph, int start, int limit = -1) {
+    std::vector<int> dist(graph.numVertices(), -1);
+    std::queue<int> q;
+    dist[start] = 0;
+    q.push(start);
+    int last = start;
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        last = node;
+        if (dist[node] == limit) break;
+        for (int neighbor : graph.neighbors(node)) {
+            if (dist[neighbor] == -1) {
+                dist[neighbor] = dist[node] + 1;
+                q.push(neighbor);
+            }
+        }
+    }
+    return last;
+}
+
+#endif // GRAPH_GENERATORS_H
@@ -0,0 +1,199 @@
+/*
+ * GRAPH REORDERING (VERTEX RELABELING FOR CACHE LOCALITY)
+ *
+ * Imported graphs often number their vertices in random order, so the per-vertex arrays of
+ * every search (visited[], cost[], parent[], heuristic[]) are accessed at random positions:
+ * almost every neighbor costs a cache miss. Relabeling the vertices so that vertices visited
+ * close together get close ids turns many of those misses into hits.
+ *
+ * Orderings:
+ * - ORDER_BFS    - breadth-first discovery order; neighbors get consecutive ids
+ * - ORDER_RCM    - Reverse Cuthill-McKee: BFS from a low-degree vertex, neighbors by increasing
+ *                  degree, then reversed; minimizes the id distance between neighbors (bandwidth)
+ * - ORDER_DEGREE - by decreasing degree; the hubs of power-law graphs share a few cache lines
+ *
+ * The permutation is kept, so callers keep working in original ids:
+ *   ReorderedGraph r = reorderGraph(graph, ORDER_RCM);
+ *   bfs(r.toNew(start), r.graph);               // search the relabeled graph
+ *   int original = r.toOld(foundVertex);        // translate results back
+ *   vector<int> h = r.permuteValues(heuristic); // per-vertex inputs follow the vertices
+ *
+ * Cost: O(V + E) for BFS order, O(V + E log d) for RCM, O(V log V) for degree order,
+ * plus O(V + E log d) to rebuild the graph (neighbor lists are sorted by new id).
+ */
+
+#ifndef GRAPH_REORDER_H
+#define GRAPH_REORDER_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include "csr_graph.h"
+
+enum GraphOrdering {
+    ORDER_BFS,
+    ORDER_RCM,
+    ORDER_DEGREE
+};
+
+/**
+ * Graph with relabeled vertices plus the permutation between old and new ids
+ */
+struct ReorderedGraph {
+    CsrGraph graph;          // Same graph, vertex ids replaced by their new ids
+    std::vector<int> newId;  // newId[original id] = relabeled id
+    std::vector<int> oldId;  // oldId[relabeled id] = original id
+
+    int toNew(int original) const { return newId[original]; }
+    int toOld(int relabeled) const { return oldId[relabeled]; }
+
+    /**
+     * Reorder a per-vertex array indexed by original id (for example a heuristic)
+     */
+    std::vector<int> permuteValues(const std::vector<int>& byOriginal) const {
+        std::vector<int> byNew(byOriginal.size());
+        for (size_t v = 0; v < byOriginal.size(); v++) byNew[newId[v]] = byOriginal[v];
+        return byNew;
+    }
+
+    /**
+     * Translate a per-vertex result indexed by new id back to original ids
+     */
+    std::vector<int> restoreValues(const std::vector<int>& byNew) const {
+        std::vector<int> byOriginal(byNew.size());
+        for (size_t v = 0; v < byNew.size(); v++) byOriginal[oldId[v]] = byNew[v];
+        return byOriginal;
+    }
+};
+
+/**
+ * Breadth-first order over all components (each new component starts at its lowest id)
+ *
+ * @return order[i] = original id of the vertex that gets new id i
+ */
+inline std::vector<int> bfsOrder(const CsrGraph& graph) {
+    int n = graph.numVertices();
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<bool> placed(n, false);
+    for (int root = 0; root < n; root++) {
+        if (placed[root]) continue;
+        placed[root] = true;
+        order.push_back(root);
+        for (size_t head = order.size() - 1; head < order.size(); head++) {  // order doubles as the queue
+            for (int neighbor : graph.neighbors(order[head])) {
+                if (!placed[neighbor]) {
+                    placed[neighbor] = true;
+                    order.push_back(neighbor);
+                }
+            }
+        }
+    }
+    return order;
+}
+
+/**
+ * Reverse Cuthill-McKee order
+ *
+ * Every component starts at its unplaced vertex of minimum degree, and the neighbors of each
+ * dequeued vertex are appended by increasing degree. The final order is reversed.
+ *
+ * @return order[i] = original id of the vertex that gets new id i
+ */
+inline std::vector<int> reverseCuthillMcKeeOrder(const CsrGraph& graph) {
+    int n = graph.numVertices();
+    std::vector<int> byDegree(n);
+    for (int v = 0; v < n; v++) byDegree[v] = v;
+    std::stable_sort(byDegree.begin(), byDegree.end(),
+                     [&](int a, int b) { return graph.degree(a) < graph.degree(b); });
+
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<bool> placed(n, false);
+    std::vector<int> fresh;  // Newly discovered neighbors of the current vertex
+    for (int root : byDegree) {
+        if (placed[root]) continue;
+        placed[root] = true;
+        order.push_back(root);
+        for (size_t head = order.size() - 1; head < order.size(); head++) {
+            fresh.clear();
+            for (int neighbor : graph.neighbors(order[head])) {
+                if (!placed[neighbor]) {
+                    placed[neighbor] = true;
+                    fresh.push_back(neighbor);
+                }
+            }
+            std::stable_sort(fresh.begin(), fresh.end(),
+                             [&](int a, int b) { return graph.degree(a) < graph.degree(b); });
+            order.insert(order.end(), fresh.begin(), fresh.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/**
+ * Decreasing-degree order (ties keep their original order)
+ *
+ * @return order[i] = original id of the vertex that gets new id i
+ */
+inline std::vector<int> degreeOrder(const CsrGraph& graph) {
+    int n = graph.numVertices();
+    std::vector<int> order(n);
+    for (int v = 0; v < n; v++) order[v] = v;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return graph.degree(a) > graph.degree(b); });
+    return order;
+}
+
+/**
+ * Relabel a graph: vertex order[i] becomes vertex i
+ *
+ * Each neighbor list is sorted by new id, so a scan touches visited[] / cost[] in increasing
+ * address order.
+ *
+ * @param graph - original graph
+ * @param order - permutation of all vertices (from bfsOrder, reverseCuthillMcKeeOrder, ...)
+ */
+inline ReorderedGraph relabelGraph(const CsrGraph& graph, const std::vector<int>& order) {
+    int n = graph.numVertices();
+    ReorderedGraph result;
+    result.oldId = order;
+    result.newId.resize(n);
+    for (int i = 0; i < n; i++) result.newId[order[i]] = i;
+
+    std::vector<int> offsets(n + 1, 0), targets(graph.numEdges());
+    std::vector<int> weights(graph.weighted() ? graph.numEdges() : 0);
+    std::vector<std::pair<int, int>> list;  // (new neighbor id, weight) of one vertex
+    for (int i = 0; i < n; i++) {
+        list.clear();
+        for (auto [neighbor, weight] : graph.edges(order[i])) list.push_back({result.newId[neighbor], weight});
+        std::sort(list.begin(), list.end());
+
+        int slot = offsets[i];
+        for (const auto& [neighbor, weight] : list) {
+            targets[slot] = neighbor;
+            if (graph.weighted()) weights[slot] = weight;
+            slot++;
+        }
+        offsets[i + 1] = slot;
+    }
+    result.graph = CsrGraph::fromVectors(std::move(offsets), std::move(targets), std::move(weights));
+    return result;
+}
+
+/**
+ * Compute an ordering and relabel the graph with it
+ *
+ * @param graph - original graph
+ * @param ordering - ORDER_BFS, ORDER_RCM or ORDER_DEGREE
+ */
+inline ReorderedGraph reorderGraph(const CsrGraph& graph, GraphOrdering ordering) {
+    switch (ordering) {
+        case ORDER_BFS: return relabelGraph(graph, bfsOrder(graph));
+        case ORDER_RCM: return relabelGraph(graph, reverseCuthillMcKeeOrder(graph));
+        default: return relabelGraph(graph, degreeOrder(graph));
+    }
+}
+
+#endif // GRAPH_REORDER_H
@@ -0,0 +1,337 @@
+/*
+ * ALT HEURISTIC (A*, LANDMARKS, TRIANGLE INEQUALITY)
+ *
+ * A hand-written h(n) array only works for the one goal it was computed for. ALT (Goldberg and
+ * Harrelson, SODA 2005) precomputes exact distances to and from a few landmark vertices L once;
+ * for any goal t the triangle inequality then gives lower bounds
+ *   d(v, t) >= d(L, t) - d(L, v)      and      d(v, t) >= d(v, L) - d(t, L)
+ * h(v) = the largest bound over the landmarks. It is admissible and consistent, so aStar with it
+ * returns shortest paths, and it is computed on the fly for whatever goal a query has.
+ *
+ *   LandmarkTable landmarks(graph, 16, LANDMARKS_AVOID);    // 2k Dijkstra runs, once
+ *   aStar(start, goal, graph, landmarks.heuristicTo(goal));
+ *   aStar(start, goal, graph, landmarks.heuristicTo(goal, start, 4));   // 4 active landmarks
+ *
+ * Landmark selection (good landmarks lie "behind" the vertices, so shortest paths point at them):
+ * - LANDMARKS_FARTHEST - each landmark is the vertex farthest from the ones already chosen
+ * - LANDMARKS_AVOID    - Goldberg and Werneck (ALENEX 2005): grow a shortest path tree from a
+ *                        root drawn far from the landmarks, weigh each vertex by how badly the
+ *                        current landmarks bound its distance from the root, and take a leaf of
+ *                        the heaviest subtree that holds no landmark yet - covers the regions
+ *                        the landmarks serve worst
+ *
+ * Table layout: one row per vertex, so evaluating h(v) reads one contiguous row
+ *   row v = d(L_0, v) .. d(L_k-1, v), then d(v, L_0) .. d(v, L_k-1)
+ * On a symmetric graph (every edge has a reverse edge of the same weight, as in undirected road
+ * graphs) both halves are equal and only the first is stored: k ints per vertex.
+ * INT_MAX marks "not reachable"; bounds through such entries are skipped.
+ *
+ * Weights must be non-negative. Graph: CsrGraph (common/csr_graph.h).
+ */
+
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include "csr_graph.h"
+#include "priority_queues.h"
+
+// How LandmarkTable picks its landmarks
+enum LandmarkStrategy {
+    LANDMARKS_FARTHEST,  // Farthest from the landmarks chosen so far
+    LANDMARKS_AVOID      // Leaf of the worst-covered subtree of a random shortest path tree
+};
+
+/**
+ * h(v) towards one goal, from a LandmarkTable; pass it to aStar in place of a heuristic vector
+ */
+class AltHeuristic {
+public:
+    int operator()(int v) const {
+        const int* row = table + (size_t)v * stride;
+        int best = 0;
+        for (size_t j = 0; j < landmark.size(); j++) {
+            int i = landmark[j];
+            int from = row[i], to = row[backward + i];
+            if (from != INT_MAX && goalFrom[j] != INT_MAX) best = std::max(best, goalFrom[j] - from);
+            if (to != INT_MAX && goalTo[j] != INT_MAX) best = std::max(best, to - goalTo[j]);
+        }
+        return best;
+    }
+
+private:
+    friend class LandmarkTable;
+    const int* table = nullptr;
+    int stride = 0;                 // Ints per row
+    int backward = 0;               // Offset of d(v, L) in a row (0 on a symmetric graph)
+    std::vector<int> landmark;      // Landmarks (indexes into the row) used for this goal
+    std::vector<int> goalFrom;      // d(L, goal) for each of them
+    std::vector<int> goalTo;        // d(goal, L) for each of them
+};
+
+class LandmarkTable {
+public:
+    /**
+     * Choose the landmarks and compute their distance tables
+     *
+     * @param graph - weighted graph in CSR form (non-negative weights)
+     * @param landmarks - number of landmarks k (more = tighter bounds, k ints or 2k ints per vertex)
+     * @param strategy - LANDMARKS_FARTHEST or LANDMARKS_AVOID
+     * @param seed - seed of the random start / root vertices
+     */
+    explicit LandmarkTable(const CsrGraph& graph, int landmarks = 16, LandmarkStrategy strategy = LANDMARKS_AVOID,
+                           unsigned seed = 1) : n(graph.numVertices()) {
+        auto begin = std::chrono::steady_clock::now();
+        CsrGraph reverse = reverseEdges(graph);
+        symmetricGraph = sameEdges(graph, reverse);
+        int k = std::min(landmarks, n);
+        stride = symmetricGraph ? k : 2 * k;
+        distance.assign((size_t)n * stride, INT_MAX);
+        selectLandmarks(graph, reverse, k, strategy, seed);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    /**
+     * h(v) towards goal using every landmark
+     */
+    AltHeuristic heuristicTo(int goal) const {
+        std::vector<int> all(numLandmarks());
+        for (int i = 0; i < numLandmarks(); i++) all[i] = i;
+        return makeHeuristic(goal, all);
+    }
+
+    /**
+     * h(v) towards goal using only the active landmarks that bound d(start, goal) best: fewer
+     * table reads per evaluation, nearly the same bounds along the start - goal corridor
+     */
+    AltHeuristic heuristicTo(int goal, int start, int active) const {
+        std::vector<std::pair<int, int>> bound;  // (-bound, landmark)
+        for (int i = 0; i < numLandmarks(); i++) bound.push_back({-landmarkBound(start, goal, i), i});
+        std::sort(bound.begin(), bound.end());
+        std::vector<int> chosen;
+        for (int i = 0; i < std::min(active, numLandmarks()); i++) chosen.push_back(bound[i].second);
+        return makeHeuristic(goal, chosen);
+    }
+
+    // Lower bound on d(v, goal) from every landmark
+    int lowerBound(int v, int goal) const {
+        int best = 0;
+        for (int i = 0; i < numLandmarks(); i++) best = std::max(best, landmarkBound(v, goal, i));
+        return best;
+    }
+
+    int numLandmarks() const { return landmarkVertex.size(); }
+    const std::vector<int>& landmarks() const { return landmarkVertex; }
+
+    // True if only d(L, v) is stored (graph found symmetric)
+    bool symmetric() const { return symmetricGraph; }
+
+    // Preprocessing time in seconds (landmark selection and distance tables)
+    double buildSeconds() const { return seconds; }
+
+    // Bytes of the distance tables
+    size_t memoryBytes() const { return distance.size() * sizeof(int) + landmarkVertex.size() * sizeof(int); }
+
+private:
+    int n;
+    int stride = 0;
+    bool symmetricGraph = false;
+    double seconds = 0;
+    std::vector<int> landmarkVertex;  // landmarkVertex[i] = vertex of landmark i
+    std::vector<int> distance;        // distance[v * stride + i]: see the table layout above
+
+    int from(int i, int v) const { return distance[(size_t)v * stride + i]; }
+    int to(int i, int v) const { return distance[(size_t)v * stride + (symmetricGraph ? 0 : stride / 2) + i]; }
+
+    // Lower bound on d(v, goal) from landmark i alone
+    int landmarkBound(int v, int goal, int i) const {
+        int best = 0;
+        if (from(i, v) != INT_MAX && from(i, goal) != INT_MAX) best = std::max(best, from(i, goal) - from(i, v));
+        if (to(i, v) != INT_MAX && to(i, goal) != INT_MAX) best = std::max(best, to(i, v) - to(i, goal));
+        return best;
+    }
+
+    AltHeuristic makeHeuristic(int goal, const std::vector<int>& chosen) const {
+        AltHeuristic h;
+        h.table = distance.data();
+        h.stride = stride;
+        h.backward = symmetricGraph ? 0 : stride / 2;
+        h.landmark = chosen;
+        for (int i : chosen) {
+            h.goalFrom.push_back(from(i, goal));
+            h.goalTo.push_back(to(i, goal));
+        }
+        return h;
+    }
+
+    /**
+     * Graph with every edge reversed (d(v, L) = distance from L in it)
+     */
+    static CsrGraph reverseEdges(const CsrGraph& graph) {
+        int n = graph.numVertices();
+        std::vector<int> offsets(n + 1, 0), targets(graph.numEdges()), weights(graph.numEdges());
+        for (int e = 0; e < graph.numEdges(); e++) offsets[graph.targetData()[e] + 1]++;
+        for (int v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+        std::vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (int v = 0; v < n; v++) {
+            for (auto [neighbor, weight] : graph.edges(v)) {
+                targets[next[neighbor]] = v;
+                weights[next[neighbor]++] = weight;
+            }
+        }
+        return CsrGraph::fromVectors(std::move(offsets), std::move(targets), std::move(weights));
+    }
+
+    // True if both graphs hold the same (target, weight) multiset for every vertex
+    static bool sameEdges(const CsrGraph& a, const CsrGraph& b) {
+        std::vector<std::pair<int, int>> edgesA, edgesB;
+        for (int v = 0; v < a.numVertices(); v++) {
+            if (a.degree(v) != b.degree(v)) return false;
+            edgesA.clear();
+            edgesB.clear();
+            for (auto edge : a.edges(v)) edgesA.push_back(edge);
+            for (auto edge : b.edges(v)) edgesB.push_back(edge);
+            std::sort(edgesA.begin(), edgesA.end());
+            std::sort(edgesB.begin(), edgesB.end());
+            if (edgesA != edgesB) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Dijkstra from source over the whole graph
+     *
+     * @param dist - receives d(source, v), INT_MAX if unreachable
+     * @param order - if not null, receives the vertices in the order they were settled
+     * @param parent - if not null, receives the shortest path tree (-1 for source / unreachable)
+     */
+    static void shortestPaths(const CsrGraph& graph, int source, std::vector<int>& dist,
+                              std::vector<int>* order = nullptr, std::vector<int>* parent = nullptr) {
+        dist.assign(graph.numVertices(), INT_MAX);
+        if (order) order->clear();
+        if (parent) parent->assign(graph.numVertices(), -1);
+        IndexedHeap<4> pq;
+        dist[source] = 0;
+        pq.push(0, source);
+        while (!pq.empty()) {
+            auto [d, v] = pq.top();
+            pq.pop();
+            if (order) order->push_back(v);
+            for (auto [neighbor, weight] : graph.edges(v)) {
+                if (d + weight < dist[neighbor]) {
+                    dist[neighbor] = d + weight;
+                    if (parent) (*parent)[neighbor] = v;
+                    pq.push(d + weight, neighbor);
+                }
+            }
+        }
+    }
+
+    /**
+     * Append landmark vertex: fill its columns of the table
+     */
+    void addLandmark(const CsrGraph& graph, const CsrGraph& reverse, int vertex, std::vector<int>& dist) {
+        int i = landmarkVertex.size();
+        landmarkVertex.push_back(vertex);
+        shortestPaths(graph, vertex, dist);
+        for (int v = 0; v < n; v++) distance[(size_t)v * stride + i] = dist[v];
+        if (!symmetricGraph) {
+            shortestPaths(reverse, vertex, dist);
+            for (int v = 0; v < n; v++) distance[(size_t)v * stride + stride / 2 + i] = dist[v];
+        }
+    }
+
+    void selectLandmarks(const CsrGraph& graph, const CsrGraph& reverse, int k, LandmarkStrategy strategy,
+                         unsigned seed) {
+        if (k == 0) return;
+        std::mt19937 rng(seed);
+        std::vector<int> dist, order, parent;
+        auto randomVertex = [&]() {
+            int v = rng() % n;
+            for (int tries = 0; graph.degree(v) == 0 && tries < 100; tries++) v = rng() % n;
+            return v;
+        };
+
+        // First landmark: farthest from a random vertex (both strategies)
+        int origin = randomVertex();
+        shortestPaths(graph, origin, dist);
+        int first = farthest(dist);
+        addLandmark(graph, reverse, first < 0 ? origin : first, dist);
+
+        std::vector<int> nearest = dist;  // Distance from the closest landmark
+        std::vector<long long> size;
+        std::vector<int> heaviest;
+        std::vector<double> weight(n);    // Prefix sums of the root probabilities (avoid strategy)
+        while (numLandmarks() < k) {
+            int next = -1;
+            if (strategy == LANDMARKS_AVOID) {
+                // Root far from the landmarks: drawn with probability ~ d(nearest landmark, v)^2
+                double total = 0;
+                for (int v = 0; v < n; v++) {
+                    if (nearest[v] != INT_MAX) total += (double)nearest[v] * nearest[v];
+                    weight[v] = total;
+                }
+                double pick = std::uniform_real_distribution<double>(0, total)(rng);
+                int root = std::lower_bound(weight.begin(), weight.end(), pick) - weight.begin();
+                if (total == 0 || root >= n) root = randomVertex();
+                shortestPaths(graph, root, dist, &order, &parent);
+
+                // size(v) = sum over v's subtree of d(root, u) - lowerBound(root, u), 0 if the
+                // subtree holds a landmark; children before parents = reverse settle order
+                size.assign(n, 0);
+                heaviest.assign(n, -1);
+                std::vector<bool> hasLandmark(n, false);
+                for (int v : landmarkVertex) hasLandmark[v] = true;
+                for (int j = order.size() - 1; j >= 0; j--) {
+                    int v = order[j];
+                    if (hasLandmark[v]) size[v] = 0;
+                    else size[v] += dist[v] - lowerBound(root, v);
+                    int p = parent[v];
+                    if (p < 0) continue;
+                    if (hasLandmark[v]) hasLandmark[p] = true;
+                    size[p] += size[v];
+                    if (heaviest[p] < 0 || size[v] > size[heaviest[p]]) heaviest[p] = v;
+                }
+                // Walk down the heaviest subtrees to a leaf
+                int v = root;
+                while (heaviest[v] >= 0 && size[heaviest[v]] > 0) v = heaviest[v];
+                if (v != root && !isLandmark(v)) next = v;
+            }
+            if (next < 0) next = farthest(nearest);  // LANDMARKS_FARTHEST, or no uncovered subtree
+            if (next < 0 || isLandmark(next)) break;  // Every reachable vertex is a landmark
+            addLandmark(graph, reverse, next, dist);
+            for (int v = 0; v < n; v++) nearest[v] = std::min(nearest[v], dist[v]);
+        }
+        int k2 = numLandmarks();
+        if (k2 < k) {  // Fewer landmarks than requested: compact the rows
+            int half = symmetricGraph ? 0 : stride / 2;
+            int newStride = symmetricGraph ? k2 : 2 * k2;
+            std::vector<int> compact((size_t)n * newStride);
+            for (int v = 0; v < n; v++) {
+                for (int i = 0; i < k2; i++) {
+                    compact[(size_t)v * newStride + i] = distance[(size_t)v * stride + i];
+                    if (!symmetricGraph) compact[(size_t)v * newStride + k2 + i] = distance[(size_t)v * stride + half + i];
+                }
+            }
+            distance.swap(compact);
+            stride = newStride;
+        }
+    }
+
+    bool isLandmark(int v) const { return std::find(landmarkVertex.begin(), landmarkVertex.end(), v) != landmarkVertex.end(); }
+
+    // Vertex with the largest finite distance, -1 if none is positive
+    static int farthest(const std::vector<int>& dist) {
+        int best = -1;
+        for (int v = 0; v < (int)dist.size(); v++) {
+            if (dist[v] != INT_MAX && dist[v] > 0 && (best < 0 || dist[v] > dist[best])) best = v;
+        }
+        return best;
+    }
+};
+
+#endif // LANDMARKS_H
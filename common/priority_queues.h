@@ -0,0 +1,274 @@
+/*
+ * PRIORITY QUEUES FOR SHORTEST-PATH SEARCHES
+ *
+ * ucs and aStar pop entries in nondecreasing key order (cost g for UCS, f = g + h for A* with a
+ * consistent heuristic) and keys are small non-negative integers. Such "monotone" queues can
+ * beat a binary heap: they never compare entries, only look at the bits of the keys.
+ *
+ * Queues (same interface, selected as a template argument: ucs<RadixHeap<int>>(start, graph)):
+ * - HeapQueue<Value>   - std::priority_queue of (key, value), O(log n) per operation; works for
+ *                        any key order (the default)
+ * - RadixHeap<Value>   - 33 buckets by the highest bit in which a key differs from the last
+ *                        popped key; every entry moves to a lower bucket at most 32 times, so
+ *                        push is O(1) and pop is O(log C) amortized (C = largest key step)
+ * - BucketQueue<Value> - Dial's algorithm: a circular array with one bucket per key value;
+ *                        O(1) push and pop when keys stay within a small window above the
+ *                        last popped key (edge weights 1..10, grid heuristics)
+ * - IndexedHeap<D>     - d-ary heap (D = 4 by default) of vertex ids with a position per vertex:
+ *                        pushing a vertex that is already queued lowers its key in place
+ *                        (decrease-key) instead of adding a duplicate, so the queue never holds
+ *                        more than V entries (the lazy queues above can grow to O(E)); works
+ *                        for any key order
+ *
+ * Interface:
+ *   queue.push(key, value);                  // key >= 0
+ *   auto [key, value] = queue.top();         // smallest key
+ *   queue.pop();
+ *   queue.empty(); queue.clear();
+ *
+ * IndexedHeap keeps its position array between queries (clear() only resets the vertices still
+ * queued); pass it by reference to reuse it: ucs<IndexedHeap<4>&>(start, graph, -1, workspace, heap).
+ *
+ * Monotone queues (RadixHeap, BucketQueue) expect every pushed key to be at least the last
+ * popped key. A smaller key (inconsistent A* heuristic) is raised to the last popped key, so it
+ * is still popped next - as a heap would do - but not ordered among those equal keys.
+ */
+
+#ifndef PRIORITY_QUEUES_H
+#define PRIORITY_QUEUES_H
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+#include <algorithm>
+
+/**
+ * Binary heap (std::priority_queue), smallest key first; equal keys by smallest value
+ */
+template <typename Value>
+class HeapQueue {
+public:
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    void push(int key, const Value& value) { heap.push({key, value}); }
+    const std::pair<int, Value>& top() const { return heap.top(); }
+    void pop() { heap.pop(); }
+    void clear() { heap = {}; }
+
+private:
+    std::priority_queue<std::pair<int, Value>, std::vector<std::pair<int, Value>>,
+                        std::greater<std::pair<int, Value>>> heap;
+};
+
+/**
+ * Radix heap for monotone non-negative integer keys
+ */
+template <typename Value>
+class RadixHeap {
+public:
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    void push(int key, const Value& value) {
+        unsigned k = std::max((unsigned)key, last);
+        buckets[bucketOf(k)].push_back({(int)k, value});
+        count++;
+    }
+
+    const std::pair<int, Value>& top() {
+        refill();
+        return buckets[0].back();
+    }
+
+    void pop() {
+        refill();
+        buckets[0].pop_back();
+        count--;
+    }
+
+    void clear() {
+        for (auto& bucket : buckets) bucket.clear();
+        count = 0;
+        last = 0;
+    }
+
+private:
+    std::vector<std::pair<int, Value>> buckets[33];  // buckets[0]: keys equal to last
+    unsigned last = 0;                               // Last popped key (lower bound of all keys)
+    size_t count = 0;
+
+    // 0 if key == last, else 1 + index of the highest bit where key and last differ
+    int bucketOf(unsigned key) const { return key == last ? 0 : 32 - __builtin_clz(key ^ last); }
+
+    // Make bucket 0 non-empty: take the first non-empty bucket, move last up to its minimum key
+    // and spread its entries over the lower buckets
+    void refill() {
+        if (!buckets[0].empty()) return;
+        int i = 1;
+        while (buckets[i].empty()) i++;
+        unsigned smallest = (unsigned)buckets[i][0].first;
+        for (const auto& entry : buckets[i]) smallest = std::min(smallest, (unsigned)entry.first);
+        last = smallest;
+        for (const auto& entry : buckets[i]) buckets[bucketOf(entry.first)].push_back(entry);
+        buckets[i].clear();
+    }
+};
+
+/**
+ * Dial's bucket queue for monotone keys within a small window above the last popped key
+ */
+template <typename Value>
+class BucketQueue {
+public:
+    /**
+     * @param window - expected largest key step (largest edge weight for UCS); the bucket array
+     *                 doubles if a key lands further ahead
+     */
+    explicit BucketQueue(int window = 16) {
+        int span = 1;
+        while (span <= window) span *= 2;
+        buckets.resize(span);
+    }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    void push(int key, const Value& value) {
+        if (!popped && (count == 0 || key < current)) current = key;  // Window starts at the smallest key
+        key = std::max(key, current);                                   // (h(start) for A*), not at 0
+        largest = std::max(count == 0 ? key : largest, key);
+        while (largest - current >= (int)buckets.size()) grow();
+        buckets[key & mask()].push_back({key, value});
+        count++;
+    }
+
+    const std::pair<int, Value>& top() {
+        advance();
+        return buckets[current & mask()].back();
+    }
+
+    void pop() {
+        advance();
+        buckets[current & mask()].pop_back();
+        count--;
+        popped = true;
+    }
+
+    void clear() {
+        for (auto& bucket : buckets) bucket.clear();
+        count = 0;
+        current = 0;
+        popped = false;
+    }
+
+private:
+    std::vector<std::vector<std::pair<int, Value>>> buckets;  // buckets[key % span], one key each
+    int current = 0;                                          // Last popped key (smallest key before any pop)
+    int largest = 0;                                          // Largest key queued
+    bool popped = false;                                      // Some key popped since clear()
+    size_t count = 0;
+
+    int mask() const { return buckets.size() - 1; }
+
+    // Move current to the smallest key in the queue (every key lies in [current, current + span)),
+    // so memory follows the window, not the largest key
+    void advance() {
+        while (buckets[current & mask()].empty()) current++;
+    }
+
+    // Double the window and re-bucket every entry
+    void grow() {
+        std::vector<std::vector<std::pair<int, Value>>> old(buckets.size() * 2);
+        old.swap(buckets);
+        for (auto& bucket : old) {
+            for (const auto& entry : bucket) buckets[entry.first & mask()].push_back(entry);
+        }
+    }
+};
+
+/**
+ * Indexed d-ary min-heap of vertex ids with decrease-key (values must be ids 0 .. V - 1)
+ */
+template <int D = 4>
+class IndexedHeap {
+public:
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    /**
+     * Insert vertex with key, or lower its key if it is queued with a larger one
+     */
+    void push(int key, int vertex) {
+        if (vertex >= (int)position.size()) position.resize(vertex + 1, -1);
+        int i = position[vertex];
+        if (i < 0) {
+            i = heap.size();
+            heap.push_back({key, vertex});
+        } else if (key < heap[i].first) {
+            heap[i].first = key;  // Decrease-key: the entry can only move up
+        } else {
+            return;
+        }
+        siftUp(i);
+    }
+
+    const std::pair<int, int>& top() const { return heap[0]; }
+
+    void pop() {
+        position[heap[0].second] = -1;
+        std::pair<int, int> lastEntry = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = lastEntry;
+            siftDown(0);
+        }
+    }
+
+    void clear() {
+        for (const auto& entry : heap) position[entry.second] = -1;
+        heap.clear();
+    }
+
+private:
+    std::vector<std::pair<int, int>> heap;  // (key, vertex); children of i: D * i + 1 .. D * i + D
+    std::vector<int> position;              // position[v] = index of v in heap, -1 if not queued
+
+    // Smaller key first, equal keys by smaller vertex id (same order as HeapQueue)
+    static bool before(const std::pair<int, int>& a, const std::pair<int, int>& b) { return a < b; }
+
+    void siftUp(int i) {
+        std::pair<int, int> entry = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (!before(entry, heap[parent])) break;
+            heap[i] = heap[parent];
+            position[heap[i].second] = i;
+            i = parent;
+        }
+        heap[i] = entry;
+        position[entry.second] = i;
+    }
+
+    void siftDown(int i) {
+        std::pair<int, int> entry = heap[i];
+        int n = heap.size();
+        while (true) {
+            int first = D * i + 1;
+            if (first >= n) break;
+            int best = first;
+            int last = std::min(first + D, n);
+            for (int c = first + 1; c < last; c++) {
+                if (before(heap[c], heap[best])) best = c;
+            }
+            if (!before(heap[best], entry)) break;
+            heap[i] = heap[best];
+            position[heap[i].second] = i;
+            i = best;
+        }
+        heap[i] = entry;
+        position[entry.second] = i;
+    }
+};
+
+#endif // PRIORITY_QUEUES_H
@@ -0,0 +1,237 @@
+/*
+ * REACHABILITY INDEX ("CAN A REACH B" QUERIES)
+ *
+ * Answering "is b reachable from a" with dfs / bidirectionalBFS walks up to the whole graph per
+ * query. This index is built once in O(k (V + E)) and answers most queries from a few integers:
+ *
+ * 1. Condensation: every strongly connected component (common/dfs_engine.h, Tarjan) becomes one
+ *    vertex of a DAG. Vertices of the same component reach each other. Tarjan numbers the
+ *    components in reverse topological order, so every DAG edge goes from a higher id to a lower
+ *    one: comp(a) < comp(b) means "not reachable" at once.
+ * 2. Interval labels (GRAIL, Yildirim et al., VLDB 2010): k randomized DFS traversals of the DAG
+ *    give every component c, per traversal, its post-order rank and
+ *      low(c)     = smallest rank among all components c reaches
+ *      treeLow(c) = smallest rank in c's DFS subtree
+ *    If a reaches b then [low(b), rank(b)] lies inside [low(a), rank(a)] in every traversal, so
+ *    one traversal without containment proves "not reachable". If rank(b) lies in
+ *    [treeLow(a), rank(a)], b is in a's DFS subtree: reachable.
+ * 3. Otherwise a DFS of the DAG from comp(a) that skips every component whose labels rule out b
+ *    (the pruned search is rare and short; it runs on the iterative engine and a SearchWorkspace).
+ *
+ *   ReachabilityIndex index(graph, 3);      // 3 interval labels per component
+ *   if (index.reachable(a, b)) ...
+ *   index.buildSeconds(), index.memoryBytes()
+ *
+ * The index is read-only after construction: concurrent queries are safe (each thread uses its
+ * own workspace).
+ */
+
+#ifndef REACHABILITY_INDEX_H
+#define REACHABILITY_INDEX_H
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include "csr_graph.h"
+#include "dfs_engine.h"
+#include "search_workspace.h"
+
+// Which step of the index decided a query
+enum ReachabilityStep {
+    REACH_SAME_COMPONENT,  // a and b in the same SCC: reachable
+    REACH_ORDER,           // comp(a) before comp(b) in reverse topological order: not reachable
+    REACH_LABELS,          // decided by the interval labels
+    REACH_SEARCH           // needed the pruned DFS
+};
+
+class ReachabilityIndex {
+public:
+    /**
+     * Build the index
+     *
+     * @param graph - directed graph (CsrGraph or CompressedGraph)
+     * @param labels - number of randomized interval labels per component (more = fewer searches)
+     * @param seed - seed of the randomized traversals
+     */
+    template <typename Graph>
+    explicit ReachabilityIndex(const Graph& graph, int labels = 3, unsigned seed = 1) : k(labels) {
+        auto begin = std::chrono::steady_clock::now();
+        components = stronglyConnectedComponents(graph, component);
+        buildCondensation(graph);
+        buildLabels(seed);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    /**
+     * Is target reachable from source (every vertex reaches itself)
+     *
+     * @param step - if not null, receives the step that decided the answer
+     * @param workspace - visited flags of the fallback search (see common/search_workspace.h)
+     */
+    bool reachable(int source, int target, ReachabilityStep* step = nullptr,
+                   SearchWorkspace& workspace = SearchWorkspace::forThread()) const {
+        int from = component[source], to = component[target];
+        ReachabilityStep decided = REACH_SAME_COMPONENT;
+        bool answer;
+        if (from == to) {
+            answer = true;
+        } else if (from < to) {
+            decided = REACH_ORDER;
+            answer = false;
+        } else if (!mayReach(from, to)) {
+            decided = REACH_LABELS;
+            answer = false;
+        } else if (inSubtree(from, to)) {
+            decided = REACH_LABELS;
+            answer = true;
+        } else {
+            decided = REACH_SEARCH;
+            answer = search(from, to, workspace);
+        }
+        if (step) *step = decided;
+        return answer;
+    }
+
+    int numComponents() const { return components; }
+    int condensationEdges() const { return dag.numEdges(); }
+    int numLabels() const { return k; }
+    const std::vector<int>& componentOf() const { return component; }
+
+    // Build time of the index in seconds
+    double buildSeconds() const { return seconds; }
+
+    // Bytes of the index: vertex -> component map, condensation DAG and labels
+    size_t memoryBytes() const {
+        return component.size() * sizeof(int) + (dag.numVertices() + 1 + dag.numEdges()) * sizeof(int) +
+               label.size() * sizeof(Label);
+    }
+
+private:
+    // One interval label of one component (post-order rank, reachable minimum, subtree minimum)
+    struct Label {
+        int rank;
+        int low;
+        int treeLow;
+    };
+
+    int k;
+    int components = 0;
+    double seconds = 0;
+    std::vector<int> component;  // component[v] = SCC id of vertex v
+    CsrGraph dag;                // Condensation: one vertex per SCC, duplicate edges removed
+    std::vector<Label> label;    // label[c * k + i] = label of component c in traversal i
+
+    /**
+     * Condensation DAG: edges between different components, without duplicates
+     */
+    template <typename Graph>
+    void buildCondensation(const Graph& graph) {
+        std::vector<std::vector<int>> members(components);
+        for (int v = 0; v < graph.numVertices(); v++) members[component[v]].push_back(v);
+
+        std::vector<int> offsets(components + 1, 0), targets;
+        std::vector<int> lastSource(components, -1);  // Marks targets already added for this component
+        for (int c = 0; c < components; c++) {
+            for (int v : members[c]) {
+                for (int neighbor : graph.neighbors(v)) {
+                    int to = component[neighbor];
+                    if (to == c || lastSource[to] == c) continue;
+                    lastSource[to] = c;
+                    targets.push_back(to);
+                }
+            }
+            offsets[c + 1] = targets.size();
+        }
+        dag = CsrGraph::fromVectors(std::move(offsets), std::move(targets), {});
+    }
+
+    /**
+     * k DFS traversals of the DAG, roots and children in a different random order each time
+     */
+    void buildLabels(unsigned seed) {
+        std::mt19937 rng(seed);
+        label.assign((size_t)components * k, Label{0, INT_MAX, INT_MAX});
+        std::vector<int> inDegree(components, 0);
+        for (int c = 0; c < components; c++) {
+            for (int to : dag.neighbors(c)) inDegree[to]++;
+        }
+        std::vector<int> roots;
+        for (int c = 0; c < components; c++) {
+            if (inDegree[c] == 0) roots.push_back(c);
+        }
+
+        std::vector<int> offsets(dag.offsetData(), dag.offsetData() + components + 1);
+        std::vector<int> targets(dag.targetData(), dag.targetData() + dag.numEdges());
+        std::vector<bool> visited(components);
+        for (int i = 0; i < k; i++) {
+            std::shuffle(roots.begin(), roots.end(), rng);
+            for (int c = 0; c < components; c++) {
+                std::shuffle(targets.begin() + offsets[c], targets.begin() + offsets[c + 1], rng);
+            }
+            CsrGraph shuffled = CsrGraph::fromArrays(components, offsets.data(), targets.data(), nullptr, nullptr);
+            DfsEngine<CsrGraph> engine(shuffled);
+            std::fill(visited.begin(), visited.end(), false);
+            int rank = 0;
+            auto at = [&](int c) -> Label& { return label[(size_t)c * k + i]; };
+
+            for (int root : roots) {
+                engine.run(root,
+                    [&](int c, int parent, int) {
+                        if (visited[c]) {  // Finished already (DAG): its reachable set is known
+                            at(parent).low = std::min(at(parent).low, at(c).low);
+                            return DFS_SKIP;
+                        }
+                        visited[c] = true;
+                        return DFS_ENTER;
+                    },
+                    [&](int c, int parent, int) {
+                        Label& l = at(c);
+                        l.rank = rank++;
+                        l.low = std::min(l.low, l.rank);
+                        l.treeLow = std::min(l.treeLow, l.rank);
+                        if (parent >= 0) {
+                            at(parent).low = std::min(at(parent).low, l.low);
+                            at(parent).treeLow = std::min(at(parent).treeLow, l.treeLow);
+                        }
+                    });
+            }
+        }
+    }
+
+    // False if some label proves that component from cannot reach component to
+    bool mayReach(int from, int to) const {
+        const Label* a = &label[(size_t)from * k];
+        const Label* b = &label[(size_t)to * k];
+        for (int i = 0; i < k; i++) {
+            if (b[i].low < a[i].low || b[i].rank > a[i].rank) return false;
+        }
+        return true;
+    }
+
+    // True if to is in from's DFS subtree in some traversal
+    bool inSubtree(int from, int to) const {
+        const Label* a = &label[(size_t)from * k];
+        const Label* b = &label[(size_t)to * k];
+        for (int i = 0; i < k; i++) {
+            if (a[i].treeLow <= b[i].rank && b[i].rank <= a[i].rank) return true;
+        }
+        return false;
+    }
+
+    // DFS of the DAG from component from, skipping components the labels rule out
+    bool search(int from, int to, SearchWorkspace& workspace) const {
+        workspace.begin(components);
+        DfsEngine<CsrGraph> engine(dag);
+        bool finished = engine.run(from, [&](int c, int, int) {
+            if (c == to || inSubtree(c, to)) return DFS_STOP;  // Found (subtree check: b is below c)
+            if (workspace.visited(c) || c < to || !mayReach(c, to)) return DFS_SKIP;
+            workspace.markVisited(c);
+            return DFS_ENTER;
+        });
+        return !finished;
+    }
+};
+
+#endif // REACHABILITY_INDEX_H
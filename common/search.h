@@ -0,0 +1,494 @@
+/*
+ * SEARCH LIBRARY (RESULT OBJECTS, COMPILE-TIME TRACING)
+ *
+ * The graph searches of this repository as header-only functions that return what they found
+ * instead of printing it:
+ *
+ *   SearchResult r = aStar(start, goal, graph, heuristic);
+ *   if (r.found) use(r.cost, r.path);               // path = start ... goal
+ *   r.expanded                                      // nodes expanded (work done)
+ *
+ * Searches (demo programs in uninformed_search/ and informed_search/):
+ *   bfs(start, graph, goal = -1)                    breadth_first_search.cpp
+ *   dfs(start, graph, goal = -1)                    depth_first_search.cpp
+ *   iddfs(start, goal, maxDepth, graph)             iterative_deepening_depth_first_search.cpp
+ *   ucs(start, graph, goal = -1)                    uniform_const_search.cpp
+ *   aStar(start, goal, graph, heuristic)            a_star_search.cpp
+ *   greedyBestFirstSearch(start, goal, graph, h)    greedy_best_first_search.cpp
+ *   idaStar(start, goal, graph, heuristic)          ida_star_search.cpp (optional expansion budget)
+ *   bidirectionalBFS(graph, start, goal)            bidirectional_search.cpp
+ * With goal = -1, bfs / dfs / ucs traverse everything reachable; ucs leaves the cost of every
+ * vertex in the workspace (workspace.cost(v)).
+ *
+ * The heuristic of aStar, greedyBestFirstSearch and idaStar is a per-node vector<int> h(n) or any
+ * function object h(v), such as the goal-agnostic ALT heuristic of common/landmarks.h:
+ *   aStar(start, goal, graph, landmarks.heuristicTo(goal));
+ *
+ * Tracing is a template parameter: a type with static functions called at each step.
+ *   struct PrintVisits : NoTrace {
+ *       static void expand(const SearchStep& s) { cout << "Visited node: " << s.node << endl; }
+ *   };
+ *   bfs<PrintVisits>(0, graph);
+ * The default, NoTrace, has empty inline functions: with it the calls compile to nothing, so the
+ * expansion loops do no I/O at all. Traces derive from NoTrace and hide only the events they use.
+ *
+ * bfs, dfs and bidirectionalBFS take CsrGraph or CompressedGraph; the weighted searches take
+ * CsrGraph. Visited flags, costs and parents live in a SearchWorkspace (common/search_workspace.h).
+ */
+
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <vector>
+#include <queue>
+#include <climits>
+#include <algorithm>
+#include "csr_graph.h"
+#include "search_workspace.h"
+#include "dfs_engine.h"
+#include "priority_queues.h"
+
+/**
+ * What a search found
+ */
+struct SearchResult {
+    bool found = false;        // Goal reached (always false for a traversal without goal)
+    int cost = -1;             // Path cost: sum of weights, or hops for unweighted searches
+    std::vector<int> path;     // start ... goal, empty if not found
+    long long expanded = 0;    // Nodes expanded
+};
+
+/**
+ * One expanded node, as passed to Trace::expand
+ */
+struct SearchStep {
+    int node;
+    int g;       // Cost from start (hops for bfs / dfs / iddfs; bidirectionalBFS: from its side's root)
+    int h;       // Heuristic value (0 for uninformed searches)
+    int limit;   // Depth limit (iddfs) or f-limit (idaStar) of the iteration, else 0
+};
+
+/**
+ * Trace policy that does nothing (the default)
+ */
+struct NoTrace {
+    static void expand(const SearchStep&) {}   // A node is expanded
+    static void iteration(int) {}              // iddfs / idaStar start an iteration with this limit
+    static void meet(int) {}                   // bidirectionalBFS: the frontiers meet at this node
+};
+
+/**
+ * Path from the start to v through the parents stored in the workspace
+ */
+inline std::vector<int> workspacePath(const SearchWorkspace& workspace, int v) {
+    std::vector<int> path;
+    for (; v != -1; v = workspace.parent(v)) path.push_back(v);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// h(n) from a per-node vector or from a function object h(v)
+inline int heuristicValue(const std::vector<int>& heuristic, int v) { return heuristic[v]; }
+template <typename Heuristic>
+int heuristicValue(const Heuristic& heuristic, int v) { return heuristic(v); }
+
+/**
+ * Breadth-First Search
+ *
+ * @param start - starting node
+ * @param graph - graph in CSR form (common/csr_graph.h) or compressed form (common/compressed_graph.h)
+ * @param goal - node to stop at, -1 to visit every reachable node
+ * @param workspace - visited flags, hop counts and parents (see common/search_workspace.h)
+ */
+template <typename Trace = NoTrace, typename Graph>
+SearchResult bfs(int start, const Graph& graph, int goal = -1,
+                 SearchWorkspace& workspace = SearchWorkspace::forThread()) {
+    SearchResult result;
+    workspace.begin(graph.numVertices());
+    std::queue<int> q;                       // Queue for BFS traversal
+    q.push(start);
+    workspace.markVisited(start);
+    workspace.setCost(start, 0, -1);
+
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        int g = workspace.cost(node);
+        result.expanded++;
+        Trace::expand({node, g, 0, 0});
+
+        if (node == goal) {
+            result.found = true;
+            result.cost = g;
+            result.path = workspacePath(workspace, node);
+            return result;
+        }
+
+        // Explore all neighbors of current node
+        for (int neighbor : graph.neighbors(node)) {
+            if (!workspace.visited(neighbor)) {
+                q.push(neighbor);
+                workspace.markVisited(neighbor);
+                workspace.setCost(neighbor, g + 1, node);
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * Depth-First Search (iterative, explicit stack: common/dfs_engine.h)
+ *
+ * @param start - starting node
+ * @param graph - graph in CSR form (common/csr_graph.h) or compressed form (common/compressed_graph.h)
+ * @param goal - node to stop at, -1 to visit every reachable node
+ * @param workspace - visited flags (see common/search_workspace.h)
+ * @return path = the DFS path that reached goal (not necessarily the shortest)
+ */
+template <typename Trace = NoTrace, typename Graph>
+SearchResult dfs(int start, const Graph& graph, int goal = -1,
+                 SearchWorkspace& workspace = SearchWorkspace::forThread()) {
+    SearchResult result;
+    workspace.begin(graph.numVertices());
+    DfsEngine<Graph> engine(graph);
+    engine.run(start, [&](int node, int, int depth) {
+        if (workspace.visited(node)) return DFS_SKIP;   // Already explored through another path
+        workspace.markVisited(node);
+        result.expanded++;
+        Trace::expand({node, depth, 0, 0});
+        if (node == goal) {
+            for (const auto& frame : engine.path()) result.path.push_back(frame.vertex);
+            result.path.push_back(node);
+            result.found = true;
+            result.cost = depth;
+            return DFS_STOP;
+        }
+        return DFS_ENTER;                               // Go deep first
+    });
+    return result;
+}
+
+/**
+ * Iterative Deepening DFS: depth-limited DFS with limits 0, 1, ..., maxDepth
+ *
+ * @param start - starting node
+ * @param target - goal node to find
+ * @param maxDepth - maximum depth to search
+ * @param graph - graph in CSR form (common/csr_graph.h) or compressed form (common/compressed_graph.h)
+ * @param workspace - visited flags, cleared in O(1) per depth (see common/search_workspace.h)
+ * @return found at the smallest depth limit that reaches target; expanded counts every iteration
+ */
+template <typename Trace = NoTrace, typename Graph>
+SearchResult iddfs(int start, int target, int maxDepth, const Graph& graph,
+                   SearchWorkspace& workspace = SearchWorkspace::forThread()) {
+    SearchResult result;
+    DfsEngine<Graph> engine(graph);
+    for (int limit = 0; limit <= maxDepth; ++limit) {
+        Trace::iteration(limit);
+        workspace.begin(graph.numVertices());   // O(1): no per-depth allocation or clearing
+
+        // Depth-limited search
+        engine.run(start, [&](int node, int, int depth) {
+            if (workspace.visited(node)) return DFS_SKIP;   // Already explored in this iteration
+            if (depth > limit) return DFS_SKIP;             // Depth limit exceeded
+            if (node == target) {
+                for (const auto& frame : engine.path()) result.path.push_back(frame.vertex);
+                result.path.push_back(node);
+                result.found = true;
+                result.cost = depth;
+                return DFS_STOP;
+            }
+            workspace.markVisited(node);
+            result.expanded++;
+            Trace::expand({node, depth, 0, limit});
+            return DFS_ENTER;
+        });
+        if (result.found) break;
+    }
+    return result;
+}
+
+/**
+ * Uniform Cost Search (Dijkstra)
+ *
+ * @param start - starting node
+ * @param graph - weighted graph in CSR form (see common/csr_graph.h)
+ * @param goal - node to stop at, -1 to compute the cost of every node (left in the workspace)
+ * @param workspace - visited flags, costs and parents, cleared in O(1) (see common/search_workspace.h)
+ * @param pq - priority queue of (cost, node) (see common/priority_queues.h)
+ */
+template <typename Queue = HeapQueue<int>, typename Trace = NoTrace>
+SearchResult ucs(int start, const CsrGraph& graph, int goal = -1,
+                 SearchWorkspace& workspace = SearchWorkspace::forThread(), Queue pq = Queue()) {
+    SearchResult result;
+    workspace.begin(graph.numVertices());
+    pq.clear();
+    workspace.setCost(start, 0, -1);
+    pq.push(0, start);
+
+    while (!pq.empty()) {
+        auto [currCost, node] = pq.top();
+        pq.pop();
+        if (workspace.visited(node)) continue;   // Stale entry
+        workspace.markVisited(node);
+        result.expanded++;
+        Trace::expand({node, currCost, 0, 0});
+
+        if (node == goal) {
+            result.found = true;
+            result.cost = currCost;
+            result.path = workspacePath(workspace, node);
+            return result;
+        }
+
+        for (auto [neighbor, weight] : graph.edges(node)) {
+            int newCost = currCost + weight;
+            if (newCost < workspace.cost(neighbor)) {
+                workspace.setCost(neighbor, newCost, node);
+                pq.push(newCost, neighbor);
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * A* Search: expands nodes by f(n) = g(n) + h(n)
+ *
+ * @param start - starting node
+ * @param goal - target node to reach
+ * @param graph - weighted graph in CSR form (see common/csr_graph.h)
+ * @param heuristic - heuristic value h(n) of every node, or a function object h(v)
+ * @param workspace - visited flags, g(n) and parents, cleared in O(1) (see common/search_workspace.h)
+ * @param pq - priority queue of (f, node); monotone queues need a consistent heuristic
+ *             (see common/priority_queues.h)
+ */
+template <typename Queue = HeapQueue<int>, typename Trace = NoTrace, typename Heuristic = std::vector<int>>
+SearchResult aStar(int start, int goal, const CsrGraph& graph, const Heuristic& heuristic,
+                   SearchWorkspace& workspace = SearchWorkspace::forThread(), Queue pq = Queue()) {
+    SearchResult result;
+    workspace.begin(graph.numVertices());
+    pq.clear();
+    pq.push(heuristicValue(heuristic, start), start);
+    workspace.setCost(start, 0, -1);
+
+    while (!pq.empty()) {
+        int node = pq.top().second;
+        pq.pop();
+        if (workspace.visited(node)) continue;
+        workspace.markVisited(node);
+
+        // First entry of node popped: it carries the smallest g(n) found, the one in the workspace
+        int g = workspace.cost(node);
+        result.expanded++;
+        Trace::expand({node, g, heuristicValue(heuristic, node), 0});
+
+        if (node == goal) {
+            result.found = true;
+            result.cost = g;
+            result.path = workspacePath(workspace, node);
+            return result;
+        }
+
+        for (auto [neighbor, weight] : graph.edges(node)) {
+            int newG = g + weight;
+            if (newG < workspace.cost(neighbor)) {
+                workspace.setCost(neighbor, newG, node);
+                pq.push(newG + heuristicValue(heuristic, neighbor), neighbor);
+            }
+        }
+    }
+    return result;
+}
+
+// Greedy Best-First Search queue entry: ordered by h only; g and parent are carried for the path
+struct GreedyNode {
+    int id;
+    int h;
+    int g;
+    int parent;
+
+    bool operator>(const GreedyNode& other) const { return h > other.h; }
+};
+
+/**
+ * Greedy Best-First Search: expands the node with the smallest h(n); fast, not optimal
+ *
+ * @param start - starting node
+ * @param goal - target node to reach
+ * @param graph - weighted graph in CSR form (see common/csr_graph.h)
+ * @param heuristic - heuristic value h(n) of every node, or a function object h(v)
+ * @param workspace - visited flags and parents, cleared in O(1) (see common/search_workspace.h)
+ * @return cost = cost of the path found (not necessarily the cheapest)
+ */
+template <typename Trace = NoTrace, typename Heuristic = std::vector<int>>
+SearchResult greedyBestFirstSearch(int start, int goal, const CsrGraph& graph, const Heuristic& heuristic,
+                                   SearchWorkspace& workspace = SearchWorkspace::forThread()) {
+    SearchResult result;
+    workspace.begin(graph.numVertices());
+    std::priority_queue<GreedyNode, std::vector<GreedyNode>, std::greater<GreedyNode>> pq;
+    pq.push({start, heuristicValue(heuristic, start), 0, -1});
+
+    while (!pq.empty()) {
+        GreedyNode current = pq.top();
+        pq.pop();
+        int node = current.id;
+        if (workspace.visited(node)) continue;
+        workspace.markVisited(node);
+        workspace.setCost(node, current.g, current.parent);  // The entry that reached node first
+        result.expanded++;
+        Trace::expand({node, current.g, current.h, 0});
+
+        if (node == goal) {
+            result.found = true;
+            result.cost = current.g;
+            result.path = workspacePath(workspace, node);
+            return result;
+        }
+
+        for (auto [neighbor, cost] : graph.edges(node)) {
+            if (!workspace.visited(neighbor)) {
+                pq.push({neighbor, heuristicValue(heuristic, neighbor), current.g + cost, node});
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * Depth-first search with an f-limit (one IDA* iteration); nodes of the current path are visited
+ *
+ * @param nextLimit - receives the smallest f above limit (the next iteration's limit)
+ * @param maxExpanded - stop (return false) once result.expanded reaches it
+ * @return true if goal found; result.path then holds goal ... start (reversed by idaStar)
+ */
+template <typename Trace, typename Heuristic>
+bool idaStarDfs(int node, int goal, int g, int limit, const CsrGraph& graph, const Heuristic& heuristic,
+                SearchWorkspace& workspace, int& nextLimit, SearchResult& result, long long maxExpanded) {
+    int h = heuristicValue(heuristic, node);
+    int f = g + h;
+    if (f > limit) {                          // Wait for the next iteration
+        nextLimit = std::min(nextLimit, f);
+        return false;
+    }
+    if (result.expanded >= maxExpanded) return false;   // Budget spent
+    result.expanded++;
+    Trace::expand({node, g, h, limit});
+
+    if (node == goal) {
+        result.found = true;
+        result.cost = g;
+        result.path.push_back(node);
+        return true;
+    }
+
+    workspace.markVisited(node);
+    for (auto [neighbor, cost] : graph.edges(node)) {
+        if (!workspace.visited(neighbor) &&
+            idaStarDfs<Trace>(neighbor, goal, g + cost, limit, graph, heuristic, workspace, nextLimit, result,
+                              maxExpanded)) {
+            result.path.push_back(node);
+            return true;
+        }
+    }
+    workspace.unmarkVisited(node);            // Backtrack to try other paths
+    return false;
+}
+
+/**
+ * IDA*: depth-first searches with increasing f-limits
+ *
+ * @param start - starting node
+ * @param goal - target node to reach
+ * @param graph - weighted graph in CSR form (see common/csr_graph.h)
+ * @param heuristic - heuristic value h(n) of every node, or a function object h(v)
+ * @param workspace - visited flags of the current path, cleared in O(1) per iteration
+ *                    (see common/search_workspace.h)
+ * @param maxExpanded - expansion budget over all iterations; IDA* is exponential on weighted
+ *                      graphs with many distinct f values
+ * @return not found with expanded == maxExpanded if the budget ran out first
+ */
+template <typename Trace = NoTrace, typename Heuristic = std::vector<int>>
+SearchResult idaStar(int start, int goal, const CsrGraph& graph, const Heuristic& heuristic,
+                     SearchWorkspace& workspace = SearchWorkspace::forThread(),
+                     long long maxExpanded = LLONG_MAX) {
+    SearchResult result;
+    int limit = heuristicValue(heuristic, start);
+    while (true) {
+        Trace::iteration(limit);
+        workspace.begin(graph.numVertices());
+        int nextLimit = INT_MAX;
+        if (idaStarDfs<Trace>(start, goal, 0, limit, graph, heuristic, workspace, nextLimit, result, maxExpanded)) {
+            std::reverse(result.path.begin(), result.path.end());
+            return result;
+        }
+        if (result.expanded >= maxExpanded) return result;   // Budget spent
+        if (nextLimit == INT_MAX) return result;   // Every reachable node explored
+        limit = nextLimit;
+    }
+}
+
+/**
+ * Bidirectional BFS: BFS levels from start and from goal in turn until the frontiers meet
+ *
+ * @param graph - unweighted, undirected graph in CSR form (common/csr_graph.h) or compressed
+ *                form (common/compressed_graph.h)
+ * @param start - starting node
+ * @param goal - target node to reach
+ * @return path through the meeting node; cost = its length in hops
+ */
+template <typename Trace = NoTrace, typename Graph>
+SearchResult bidirectionalBFS(const Graph& graph, int start, int goal) {
+    SearchResult result;
+    int n = graph.numVertices();
+    std::vector<int> parentFwd(n, -2), parentBwd(n, -2);   // -2 = not visited, -1 = root
+    std::vector<int> qFwd = {start}, qBwd = {goal};         // Current levels
+    std::vector<int> next;
+    int depthFwd = 0, depthBwd = 0;                          // Hops from start / from goal
+    parentFwd[start] = -1;
+    parentBwd[goal] = -1;
+
+    // Joined path: start ... meet from the forward parents, then meet ... goal from the backward ones
+    auto finish = [&](int meet) {
+        Trace::meet(meet);
+        for (int v = meet; v != -1; v = parentFwd[v]) result.path.push_back(v);
+        std::reverse(result.path.begin(), result.path.end());
+        for (int v = parentBwd[meet]; v != -1; v = parentBwd[v]) result.path.push_back(v);
+        result.found = true;
+        result.cost = result.path.size() - 1;
+    };
+    if (start == goal) {
+        finish(start);
+        return result;
+    }
+
+    // Expand one level of one side; returns the meeting node or -1
+    auto expandLevel = [&](std::vector<int>& level, std::vector<int>& parent, const std::vector<int>& other, int& depth) {
+        next.clear();
+        for (int current : level) {
+            result.expanded++;
+            Trace::expand({current, depth, 0, 0});
+            for (int neighbor : graph.neighbors(current)) {
+                if (parent[neighbor] != -2) continue;
+                parent[neighbor] = current;
+                next.push_back(neighbor);
+                if (other[neighbor] != -2) return neighbor;   // Reached by the other side
+            }
+        }
+        level.swap(next);
+        depth++;
+        return -1;
+    };
+
+    while (!qFwd.empty() && !qBwd.empty()) {
+        int meet = expandLevel(qFwd, parentFwd, parentBwd, depthFwd);
+        if (meet == -1) meet = expandLevel(qBwd, parentBwd, parentFwd, depthBwd);
+        if (meet != -1) {
+            finish(meet);
+            return result;
+        }
+    }
+    return result;
+}
+
+#endif // SEARCH_H
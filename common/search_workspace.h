@@ -0,0 +1,89 @@
+/*
+ * REUSABLE SEARCH WORKSPACE (EPOCH-STAMPED VISITED / COST ARRAYS)
+ *
+ * The searches keep per-vertex state (visited flags, best known cost g(n)) that has to start
+ * out "empty" for every query. Allocating and clearing vector<bool>(V) and vector<int>(V, INT_MAX)
+ * costs O(V) per call - on a 50M-vertex graph that dominates any query that touches a few
+ * thousand vertices, and IDDFS / IDA* pay it again for every depth or f-limit.
+ *
+ * A workspace keeps the arrays between queries and pairs every entry with a stamp. An entry is
+ * live only if its stamp equals the current epoch; begin() starts a new query by incrementing
+ * the epoch, which "clears" every entry in O(1). Only entries touched by the current query are
+ * ever read back as set.
+ *
+ *   SearchWorkspace& ws = SearchWorkspace::forThread();  // one per thread, reused by every call
+ *   ws.begin(graph.numVertices());                       // O(1) unless the graph grew
+ *   if (!ws.visited(v)) ws.markVisited(v);
+ *   if (newCost < ws.cost(v)) ws.setCost(v, newCost);    // cost() is INT_MAX until set
+ *   ws.setCost(v, newCost, u);                           // ... and remember the parent for paths
+ *
+ * The stamps are 32-bit; when the epoch wraps around (every 4 billion queries) the stamps are
+ * cleared once, so stale entries can never look live.
+ *
+ * A workspace is not thread-safe: use one per thread (forThread() returns a thread_local one).
+ */
+
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include <vector>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+
+class SearchWorkspace {
+public:
+    /**
+     * Start a new query over vertices 0 .. n - 1: every vertex becomes unvisited with cost INT_MAX
+     */
+    void begin(int n) {
+        if ((int)visitStamp.size() < n) {
+            visitStamp.resize(n, 0);
+            costStamp.resize(n, 0);
+            costValue.resize(n);
+            parentValue.resize(n);
+        }
+        if (++epoch == 0) {  // Wrapped around: stamps from 4 billion queries ago would match again
+            std::fill(visitStamp.begin(), visitStamp.end(), 0);
+            std::fill(costStamp.begin(), costStamp.end(), 0);
+            epoch = 1;
+        }
+    }
+
+    bool visited(int v) const { return visitStamp[v] == epoch; }
+    void markVisited(int v) { visitStamp[v] = epoch; }
+    void unmarkVisited(int v) { visitStamp[v] = 0; }  // Backtracking (IDA*)
+
+    int cost(int v) const { return costStamp[v] == epoch ? costValue[v] : INT_MAX; }
+    void setCost(int v, int value) {
+        costStamp[v] = epoch;
+        costValue[v] = value;
+    }
+
+    // Cost together with the vertex it was reached from (path reconstruction)
+    void setCost(int v, int value, int parent) {
+        setCost(v, value);
+        parentValue[v] = parent;
+    }
+    int parent(int v) const { return parentValue[v]; }  // Valid only while cost(v) is set
+
+    // Vertices the arrays can hold without growing
+    int capacity() const { return visitStamp.size(); }
+
+    /**
+     * Workspace of the calling thread (created on first use, kept until the thread exits)
+     */
+    static SearchWorkspace& forThread() {
+        thread_local SearchWorkspace workspace;
+        return workspace;
+    }
+
+private:
+    uint32_t epoch = 0;                 // Stamp of the current query (0 is never live)
+    std::vector<uint32_t> visitStamp;   // visitStamp[v] == epoch: v visited in this query
+    std::vector<uint32_t> costStamp;    // costStamp[v] == epoch: costValue[v] is valid
+    std::vector<int> costValue;
+    std::vector<int> parentValue;       // Written only by the three-argument setCost
+};
+
+#endif // SEARCH_WORKSPACE_H
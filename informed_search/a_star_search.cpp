@@ -20,95 +20,54 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <utility>
-#include <limits>
+#include "../common/csr_graph.h"
+#include "../common/search.h"
+#include "../common/landmarks.h"
 using namespace std;
 
 // Edge structure: pair<destination node, cost>
 using Edge = pair<int, int>;
 
-/**
- * Node structure for A* priority queue
- * Contains node information and evaluation values
+/*
+ * aStar(start, goal, graph, heuristic) lives in common/search.h and returns a SearchResult
+ * (found, total cost, path, nodes expanded). The queue is the first template argument:
+ * HeapQueue (binary heap, default), IndexedHeap (decrease-key, at most V entries), or
+ * RadixHeap / BucketQueue for integer weights and a consistent heuristic
+ * (see common/priority_queues.h). This trace policy prints every expanded node.
  */
-struct Node {
-    int id;     // Node identifier
-    int g;      // Actual cost from start to this node
-    int f;      // Evaluation function: f(n) = g(n) + h(n)
-
-    // Priority queue comparator (min-heap based on f value)
-    bool operator>(const Node& other) const {
-        return f > other.f;
+struct PrintVisits : NoTrace {
+    static void expand(const SearchStep& step) {
+        cout << "\nVisited node: " << step.node
+             << " (g = " << step.g
+             << ", h = " << step.h
+             << ", f = " << step.g + step.h << ")\n";
     }
 };
 
-/**
- * A* Search Algorithm
- * 
- * @param start - starting node
- * @param goal - target node to reach
- * @param graph - weighted graph represented as adjacency list
- * @param heuristic - heuristic function values for each node
- */
-void aStar(int start, int goal, const vector<vector<Edge>>& graph, const vector<int>& heuristic) {
-    int n = graph.size();
-    vector<bool> visited(n, false);        // Track visited nodes
-    vector<int> cost(n, INT_MAX);          // Store minimum g(n) values
-
-    // Priority queue ordered by f(n) = g(n) + h(n)
-    priority_queue<Node, vector<Node>, greater<Node>> pq;
-    pq.push({start, 0, heuristic[start]}); // Start node: g=0, f=h(start)
-    cost[start] = 0;
-
-    while (!pq.empty()) {
-        Node current = pq.top(); pq.pop();
-        int node = current.id;
-
-        // Skip if already visited
-        if (visited[node]) continue;
-        visited[node] = true;
-
-        // Display current node information
-        cout << "\nVisited node: " << node
-             << " (g = " << current.g
-             << ", h = " << heuristic[node]
-             << ", f = " << current.f << ")\n";
-
-        // Check if goal reached
-        if (node == goal) {
-            cout << "\nGoal reached at node " << node
-                 << "! (Total cost: " << current.g << ")\n";
-            return;
-        }
-
-        // Explore all neighbors
-        for (auto [neighbor, weight] : graph[node]) {
-            int newG = current.g + weight;             // New actual cost
-            int newF = newG + heuristic[neighbor];     // New evaluation: f = g + h
-
-            if (newG < cost[neighbor]) {               // If this path is better
-                cost[neighbor] = newG;                 // Update minimum cost
-                pq.push({neighbor, newG, newF});       // Add to priority queue
-            }
-        }
+// Display the outcome of one search
+void report(const SearchResult& result, int goal) {
+    if (result.found) {
+        cout << "\nGoal reached at node " << goal
+             << "! (Total cost: " << result.cost << ")\n";
+    } else {
+        cout << "\nGoal cannot be reached\n";
     }
-
-    cout << "\nGoal cannot be reached\n";
 }
 
 int main() {
     int n = 6; // Number of nodes
-    vector<vector<Edge>> graph(n);
+    vector<vector<Edge>> adjacency(n);
 
     // Create weighted directed graph
     // Each edge: {destination, cost}
-    graph[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
-    graph[1] = {{3, 2}, {4, 3}};  // Node 1: to nodes 3,4
-    graph[2] = {{4, 2}};          // Node 2: to node 4
-    graph[3] = {{5, 1}};          // Node 3: to node 5
-    graph[4] = {{5, 2}};          // Node 4: to node 5
-    graph[5] = {};                 // Goal node (no outgoing edges)
+    adjacency[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
+    adjacency[1] = {{3, 2}, {4, 3}};  // Node 1: to nodes 3,4
+    adjacency[2] = {{4, 2}};          // Node 2: to node 4
+    adjacency[3] = {{5, 1}};          // Node 3: to node 5
+    adjacency[4] = {{5, 2}};          // Node 4: to node 5
+    adjacency[5] = {};                 // Goal node (no outgoing edges)
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     // Heuristic function h(n): estimated distance to goal (node 5)
     // Should never overestimate the actual cost (admissible heuristic)
@@ -125,7 +84,13 @@ int main() {
     int goal = 5;
 
     cout << "\nA* Search from node " << start << " to " << goal << ":\n";
-    aStar(start, goal, graph, heuristic);
+    report(aStar<HeapQueue<int>, PrintVisits>(start, goal, graph, heuristic), goal);
+
+    // Same search with the ALT heuristic (common/landmarks.h): exact distances from 2 landmarks
+    // bound d(n, goal) for any goal, no hand-written h(n) needed
+    LandmarkTable landmarks(graph, 2);
+    cout << "\nA* Search with ALT landmarks from node " << start << " to " << goal << ":\n";
+    report(aStar<HeapQueue<int>, PrintVisits>(start, goal, graph, landmarks.heuristicTo(goal)), goal);
 
     return 0;
 }
@@ -143,16 +108,21 @@ int main() {
  * - Admissible: h(n) ≤ actual cost to goal (never overestimate)
  * - Consistent: h(n) ≤ cost(n,n') + h(n') for all neighbors
  * - Better heuristics lead to faster search
+ * - ALT (landmarks + triangle inequality) gives an admissible, consistent h(n) for any goal
  * 
  * Data Structures Used:
- * - Priority Queue: Orders nodes by f(n) value
- * - Vector<bool>: Tracks visited nodes
- * - Vector<int>: Stores minimum g(n) values
- * - Adjacency List: Weighted graph representation
+ * - Priority Queue: Orders nodes by f(n) value; binary heap by default, indexed 4-ary heap with
+ *   decrease-key, radix heap or Dial's buckets for integer weights with a consistent heuristic
+ *   (common/priority_queues.h)
+ * - Search Workspace: Epoch-stamped visited flags, minimum g(n) values and parents (path), reused
+ * - Landmark Table: Distances to / from k landmarks per vertex for the ALT heuristic
+ *   (common/landmarks.h)
+ * - CSR Graph: Contiguous weighted adjacency arrays (common/csr_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(E log V) - each edge processed once
- * - Space Complexity: O(V) - priority queue size
+ * - Space Complexity: O(V) - visited/cost arrays; the lazy queues hold up to O(E) entries,
+ *   the indexed heap at most V
  * 
  * Advantages:
  * - Guarantees optimal path with admissible heuristic
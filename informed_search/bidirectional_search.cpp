@@ -20,128 +20,57 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
-#include <unordered_map>
-#include <algorithm>
+#include "../common/csr_graph.h"
+#include "../common/compressed_graph.h"
+#include "../common/search.h"
 using namespace std;
 
-/**
- * Print the complete path from start to goal
- * Combines paths from both forward and backward searches
- * 
- * @param meet - meeting point where searches intersect
- * @param parent_fwd - parent pointers from forward search
- * @param parent_bwd - parent pointers from backward search
+/*
+ * bidirectionalBFS(graph, start, goal) lives in common/search.h and returns a SearchResult
+ * (found, hops, path start ... goal, nodes expanded). It expands one whole BFS level from each
+ * side in turn; parents live in flat arrays, one per direction. This trace policy prints the
+ * meeting node.
  */
-void printPath(int meet,
-               unordered_map<int, int>& parent_fwd,
-               unordered_map<int, int>& parent_bwd) {
-    vector<int> path;
-
-    // Trace back from meeting point to start
-    int node = meet;
-    while (parent_fwd.count(node)) {
-        path.push_back(node);
-        node = parent_fwd[node];
-    }
-    path.push_back(node); // Add start node
-    reverse(path.begin(), path.end());
-
-    // Trace forward from meeting point to goal
-    node = meet;
-    while (parent_bwd.count(node)) {
-        node = parent_bwd[node];
-        path.push_back(node);
+struct PrintMeet : NoTrace {
+    static void meet(int node) { cout << "\nSearch frontiers meet at node: " << node << endl; }
+};
+
+// Display the path found, or that there is none
+void report(const SearchResult& result, int start, int goal) {
+    if (!result.found) {
+        cout << "\nNo path found from " << start << " to " << goal << endl;
+        return;
     }
-
-    // Display complete path
     cout << "\nPath found: ";
-    for (int n : path) cout << n << " ";
+    for (int n : result.path) cout << n << " ";
     cout << endl;
 }
 
-/**
- * Bidirectional BFS Algorithm
- * 
- * @param graph - unweighted graph represented as adjacency list
- * @param start - starting node
- * @param goal - target node to reach
- * @return true if path found, false otherwise
- */
-bool bidirectionalBFS(const vector<vector<int>>& graph, int start, int goal) {
-    int n = graph.size();
-    vector<bool> visited_fwd(n, false), visited_bwd(n, false); // Track visited nodes for each direction
-    unordered_map<int, int> parent_fwd, parent_bwd;             // Parent pointers for path reconstruction
-
-    queue<int> q_fwd, q_bwd; // Queues for forward and backward searches
-    q_fwd.push(start); visited_fwd[start] = true;  // Start forward search
-    q_bwd.push(goal);  visited_bwd[goal] = true;   // Start backward search
-
-    while (!q_fwd.empty() && !q_bwd.empty()) {
-        // Forward search (from start)
-        int size_f = q_fwd.size();
-        while (size_f--) {
-            int current = q_fwd.front(); q_fwd.pop();
-            for (int neighbor : graph[current]) {
-                if (!visited_fwd[neighbor]) {
-                    visited_fwd[neighbor] = true;
-                    parent_fwd[neighbor] = current;
-                    q_fwd.push(neighbor);
-
-                    // Check if backward search has visited this node
-                    if (visited_bwd[neighbor]) {
-                        cout << "\nSearch frontiers meet at node: " << neighbor << endl;
-                        printPath(neighbor, parent_fwd, parent_bwd);
-                        return true;
-                    }
-                }
-            }
-        }
-
-        // Backward search (from goal)
-        int size_b = q_bwd.size();
-        while (size_b--) {
-            int current = q_bwd.front(); q_bwd.pop();
-            for (int neighbor : graph[current]) {
-                if (!visited_bwd[neighbor]) {
-                    visited_bwd[neighbor] = true;
-                    parent_bwd[neighbor] = current;
-                    q_bwd.push(neighbor);
-
-                    // Check if forward search has visited this node
-                    if (visited_fwd[neighbor]) {
-                        cout << "\nSearch frontiers meet at node: " << neighbor << endl;
-                        printPath(neighbor, parent_fwd, parent_bwd);
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-
-    cout << "\nNo path found from " << start << " to " << goal << endl;
-    return false;
-}
-
 int main() {
     int n = 7; // Number of nodes
-    vector<vector<int>> graph(n);
+    vector<vector<int>> adjacency(n);
 
     // Create undirected unweighted graph
     // Each vector contains neighbors of that node
-    graph[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
-    graph[1] = {0, 3};  // Node 1 connects to nodes 0 and 3
-    graph[2] = {0, 4};  // Node 2 connects to nodes 0 and 4
-    graph[3] = {1, 5};  // Node 3 connects to nodes 1 and 5
-    graph[4] = {2, 5};  // Node 4 connects to nodes 2 and 5
-    graph[5] = {3, 4, 6}; // Node 5 connects to nodes 3, 4, and 6
-    graph[6] = {5};      // Node 6 connects to node 5
+    adjacency[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
+    adjacency[1] = {0, 3};  // Node 1 connects to nodes 0 and 3
+    adjacency[2] = {0, 4};  // Node 2 connects to nodes 0 and 4
+    adjacency[3] = {1, 5};  // Node 3 connects to nodes 1 and 5
+    adjacency[4] = {2, 5};  // Node 4 connects to nodes 2 and 5
+    adjacency[5] = {3, 4, 6}; // Node 5 connects to nodes 3, 4, and 6
+    adjacency[6] = {5};      // Node 6 connects to node 5
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     int start = 0;
     int goal = 6;
 
     cout << "\nBidirectional BFS Search from " << start << " to " << goal << ":\n";
-    bidirectionalBFS(graph, start, goal);
+    report(bidirectionalBFS<PrintMeet>(graph, start, goal), start, goal);
+
+    // Same search on the compressed (delta + varint) representation
+    CompressedGraph compressed = CompressedGraph::fromCsr(graph);
+    cout << "\nBidirectional BFS on the compressed graph:\n";
+    report(bidirectionalBFS<PrintMeet>(compressed, start, goal), start, goal);
     return 0;
 }
 
@@ -163,10 +92,10 @@ int main() {
  * - Combine paths from both directions
  * 
  * Data Structures Used:
- * - Two Queues: Forward and backward BFS
- * - Two Vector<bool>: Track visited nodes for each direction
- * - Two Unordered Maps: Store parent pointers for path reconstruction
- * - Adjacency List: Graph representation
+ * - Two Level Vectors: Current BFS level of the forward and backward search
+ * - Two Parent Arrays: Visited marks and parent pointers for path reconstruction, one per direction
+ * - CSR Graph: Contiguous adjacency arrays (common/csr_graph.h)
+ * - Compressed Graph: Delta + varint neighbor lists, decoded while iterating (common/compressed_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(b^(d/2)) - searches meet halfway
@@ -20,82 +20,38 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <utility>
+#include "../common/csr_graph.h"
+#include "../common/search.h"
 using namespace std;
 
 // Edge structure: pair<destination, cost>
 using Edge = pair<int, int>;
 
-/**
- * Node structure for Greedy Best-First Search priority queue
- * Contains only node identifier and heuristic value
+/*
+ * greedyBestFirstSearch(start, goal, graph, heuristic) lives in common/search.h and returns a
+ * SearchResult (found, cost of the path taken, path, nodes expanded). Its queue entries are
+ * ordered by h(n) only. This trace policy prints every expanded node.
  */
-struct Node {
-    int id;  // Node identifier
-    int h;   // Heuristic value h(n)
-
-    // Priority queue comparator (min-heap based on h value)
-    bool operator>(const Node& other) const {
-        return h > other.h;
+struct PrintVisits : NoTrace {
+    static void expand(const SearchStep& step) {
+        cout << "\nVisited node: " << step.node << " (h = " << step.h << ")\n";
     }
 };
 
-/**
- * Greedy Best-First Search Algorithm
- * 
- * @param start - starting node
- * @param goal - target node to reach
- * @param graph - weighted graph represented as adjacency list
- * @param heuristic - heuristic function values for each node
- */
-void greedyBestFirstSearch(int start, int goal,
-                           const vector<vector<Edge>>& graph, const vector<int>& heuristic) {
-    int n = graph.size();
-    vector<bool> visited(n, false);           // Track visited nodes
-
-    // Priority queue ordered by heuristic value only
-    priority_queue<Node, vector<Node>, greater<Node>> pq;
-    pq.push({start, heuristic[start]});       // Add start node with its heuristic
-
-    while (!pq.empty()) {
-        Node current = pq.top(); pq.pop();
-        int node = current.id;
-
-        if (visited[node]) continue;          // Skip if already visited
-        visited[node] = true;                 // Mark as visited
-
-        cout << "\nVisited node: " << node
-             << " (h = " << heuristic[node] << ")\n";
-
-        if (node == goal) {
-            cout << "\nGoal reached at node " << node << "!\n";
-            return;
-        }
-
-        // Explore all unvisited neighbors
-        for (auto [neighbor, cost] : graph[node]) {
-            if (!visited[neighbor]) {
-                pq.push({neighbor, heuristic[neighbor]}); // Add with heuristic value
-            }
-        }
-    }
-
-    cout << "\nGoal cannot be reached\n";
-}
-
 int main() {
     int n = 6; // Number of nodes
-    vector<vector<Edge>> graph(n);
+    vector<vector<Edge>> adjacency(n);
 
     // Create weighted directed graph
     // Each edge: {destination, cost}
-    graph[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
-    graph[1] = {{3, 2}, {4, 3}};  // Node 1: to nodes 3,4
-    graph[2] = {{4, 2}};          // Node 2: to node 4
-    graph[3] = {{5, 1}};          // Node 3: to node 5
-    graph[4] = {{5, 2}};          // Node 4: to node 5
-    graph[5] = {};                 // Goal node (no outgoing edges)
+    adjacency[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
+    adjacency[1] = {{3, 2}, {4, 3}};  // Node 1: to nodes 3,4
+    adjacency[2] = {{4, 2}};          // Node 2: to node 4
+    adjacency[3] = {{5, 1}};          // Node 3: to node 5
+    adjacency[4] = {{5, 2}};          // Node 4: to node 5
+    adjacency[5] = {};                 // Goal node (no outgoing edges)
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     // Heuristic function h(n): estimated distance to goal (node 5)
     vector<int> heuristic = {
@@ -111,7 +67,12 @@ int main() {
     int goal = 5;
 
     cout << "\nGreedy Best-First Search from node " << start << " to " << goal << ":\n";
-    greedyBestFirstSearch(start, goal, graph, heuristic);
+    SearchResult result = greedyBestFirstSearch<PrintVisits>(start, goal, graph, heuristic);
+    if (result.found) {
+        cout << "\nGoal reached at node " << goal << "!\n";
+    } else {
+        cout << "\nGoal cannot be reached\n";
+    }
     return 0;
 }
 
@@ -126,8 +87,8 @@ int main() {
  * 
  * Data Structures Used:
  * - Priority Queue: Orders nodes by heuristic value only
- * - Vector<bool>: Tracks visited nodes
- * - Adjacency List: Weighted graph representation
+ * - Search Workspace: Epoch-stamped visited flags and parents (path), reused across calls
+ * - CSR Graph: Contiguous weighted adjacency arrays (common/csr_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(E log V) - each edge processed once
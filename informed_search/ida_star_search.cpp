@@ -21,106 +21,42 @@
 #include <iostream>
 #include <vector>
 #include <utility>
-#include <limits>
+#include "../common/csr_graph.h"
+#include "../common/search.h"
 using namespace std;
 
 // Edge structure: pair<destination, cost>
 using Edge = pair<int, int>;
-const int INF = numeric_limits<int>::max();
 
-/**
- * Depth-First Search with f-value limit (DLS for IDA*)
- * 
- * @param node - current node being visited
- * @param goal - target node to reach
- * @param g - actual cost from start to current node
- * @param limit - f-value limit for this iteration
- * @param graph - weighted graph represented as adjacency list
- * @param heuristic - heuristic function values for each node
- * @param visited - boolean array to track visited nodes
- * @param next_limit - reference to store next f-limit
- * @return true if goal found, false otherwise
- */
-bool dfs(int node, int goal, int g, int limit,
-         const vector<vector<Edge>>& graph, const vector<int>& heuristic,
-         vector<bool>& visited, int& next_limit) {
-    int f = g + heuristic[node]; // f(n) = g(n) + h(n)
-
-    // If f exceeds limit, wait for next iteration
-    if (f > limit) {
-        next_limit = min(next_limit, f);
-        return false;
-    }
-
-    // Display current node information
-    cout << "Visited node: " << node
-         << " (g = " << g
-         << ", h = " << heuristic[node]
-         << ", f = " << f << ")\n";
-
-    if (node == goal) {
-        cout << "\nGoal reached at node " << node << "! (cost: " << g << ")\n";
-        return true;
-    }
-
-    visited[node] = true;
-
-    // Explore all neighbors
-    for (auto [neighbor, cost] : graph[node]) {
-        if (!visited[neighbor]) {
-            if (dfs(neighbor, goal, g + cost, limit, graph, heuristic, visited, next_limit)) {
-                return true; // Goal found
-            }
-        }
-    }
-
-    visited[node] = false; // Backtrack to try other paths
-    return false;
-}
-
-/**
- * IDA* Algorithm: Iterative deepening with f-value limits
- * 
- * @param start - starting node
- * @param goal - target node to reach
- * @param graph - weighted graph represented as adjacency list
- * @param heuristic - heuristic function values for each node
+/*
+ * idaStar(start, goal, graph, heuristic) lives in common/search.h and returns a SearchResult
+ * (found, cost, path, nodes expanded over all iterations). Each iteration is a depth-first search
+ * bounded by an f-limit; the next limit is the smallest f that exceeded the current one. This
+ * trace policy prints every iteration and expanded node.
  */
-void idaStar(int start, int goal,
-             const vector<vector<Edge>>& graph, const vector<int>& heuristic) {
-    int limit = heuristic[start]; // Start with h(start) as initial limit
-
-    while (true) {
-        cout << "\nNew iteration: limit = " << limit << "\n";
-        vector<bool> visited(graph.size(), false);
-        int next_limit = INF;
-
-        // Run DFS with current f-limit
-        if (dfs(start, goal, 0, limit, graph, heuristic, visited, next_limit)) {
-            return; // Goal found
-        }
-
-        if (next_limit == INF) {
-            cout << "\nGoal not found at any depth\n";
-            return;
-        }
-
-        limit = next_limit; // Increase limit for next iteration
+struct PrintSteps : NoTrace {
+    static void iteration(int limit) { cout << "\nNew iteration: limit = " << limit << "\n"; }
+    static void expand(const SearchStep& step) {
+        cout << "Visited node: " << step.node
+             << " (g = " << step.g
+             << ", h = " << step.h
+             << ", f = " << step.g + step.h << ")\n";
     }
-}
+};
 
 int main() {
     int n = 6; // Number of nodes
-    vector<vector<Edge>> graph(n);
+    vector<vector<Edge>> adjacency(n);
 
     // Create weighted directed graph
     // Each edge: {destination, cost}
-    graph[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
-    graph[1] = {{3, 2}, {4, 3}};  // Node 1: to nodes 3,4
-    graph[2] = {{4, 2}};          // Node 2: to node 4
-    graph[3] = {{5, 1}};          // Node 3: to node 5
-    graph[4] = {{5, 2}};          // Node 4: to node 5
-    graph[5] = {};                 // Goal node (no outgoing edges)
+    adjacency[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
+    adjacency[1] = {{3, 2}, {4, 3}};  // Node 1: to nodes 3,4
+    adjacency[2] = {{4, 2}};          // Node 2: to node 4
+    adjacency[3] = {{5, 1}};          // Node 3: to node 5
+    adjacency[4] = {{5, 2}};          // Node 4: to node 5
+    adjacency[5] = {};                 // Goal node (no outgoing edges)
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     // Heuristic function h(n): estimated distance to goal (node 5)
     // Should never overestimate the actual cost (admissible heuristic)
@@ -137,7 +73,12 @@ int main() {
     int goal = 5;
 
     cout << "\nIDA* Search from node " << start << " to " << goal << ":\n";
-    idaStar(start, goal, graph, heuristic);
+    SearchResult result = idaStar<PrintSteps>(start, goal, graph, heuristic);
+    if (result.found) {
+        cout << "\nGoal reached at node " << goal << "! (cost: " << result.cost << ")\n";
+    } else {
+        cout << "\nGoal not found at any depth\n";
+    }
     return 0;
 }
 
@@ -159,8 +100,8 @@ int main() {
  * 
  * Data Structures Used:
  * - Recursion Stack: Implements DFS (LIFO)
- * - Vector<bool>: Tracks visited nodes
- * - Adjacency List: Weighted graph representation
+ * - Search Workspace: Epoch-stamped visited flags, reused across iterations and calls
+ * - CSR Graph: Contiguous weighted adjacency arrays (common/csr_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(b^d) - may repeat work at shallow levels
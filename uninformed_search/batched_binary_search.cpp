@@ -0,0 +1,146 @@
+/*
+ * BATCHED (INTERLEAVED) BINARY SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Answers many Binary Search queries at once by advancing all of them one level at a time
+ *
+ * Key Characteristics:
+ * - Takes a whole batch of targets against the same sorted array
+ * - Runs a group of searches in lockstep: level 1 of every search, then level 2, ...
+ * - Prefetches the next probe of each search while the other searches are working
+ * - Branchless step (base += (base[half] < target) * half), no mispredicted branches
+ * - Same -1 / index semantics as binarySearch()
+ *
+ * Time Complexity: O(k log n) for k targets - same work, but memory misses overlap
+ * Space Complexity: O(1) extra (plus the k results)
+ *
+ * Best for: Millions of point lookups against one large sorted array
+ * Worst for: A single lookup (nothing to interleave with)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "../common/array_search.h"
+using namespace std;
+
+// Number of searches advanced together; enough independent loads to cover DRAM latency
+const int INTERLEAVE = 32;
+
+/**
+ * Batched Binary Search Function
+ *
+ * @param arr[] - sorted input array to search in
+ * @param size - size of the array
+ * @param targets[] - values to search for
+ * @param count - number of targets
+ * @param results[] - receives, for each target, its index in arr or -1 if not found
+ *                    (the first occurrence when the array has duplicates)
+ */
+void batchBinarySearch(const int arr[], int size, const int targets[], int count, int results[]) {
+    if (size == 0) {
+        fill(results, results + count, -1);
+        return;
+    }
+
+    for (int first = 0; first < count; first += INTERLEAVE) {
+        int group = min(INTERLEAVE, count - first);
+        const int* t = targets + first;
+        const int* base[INTERLEAVE];   // Start of the remaining range of each search
+        for (int q = 0; q < group; q++) base[q] = arr;
+
+        // All searches over the same array shrink their range identically,
+        // so one length n drives the whole group
+        int n = size;
+        while (n > 1) {
+            int half = n / 2;
+            int nextHalf = (n - half) / 2;
+            for (int q = 0; q < group; q++) {
+                base[q] += (base[q][half] < t[q]) * half;  // Branchless: move right or stay
+                __builtin_prefetch(base[q] + nextHalf);    // Next probe of this search
+            }
+            n -= half;
+        }
+
+        // base[q] now points at the last element < t[q] (or the first element)
+        for (int q = 0; q < group; q++) {
+            int index = (base[q] - arr) + (*base[q] < t[q]);  // Lower bound of t[q]
+            results[first + q] = (index < size && arr[index] == t[q]) ? index : -1;
+        }
+    }
+}
+
+int main() {
+    // Sample data array (MUST be sorted) - same example as binary_search.cpp
+    int data[] = {10, 20, 30, 40, 50, 60};
+    int size = sizeof(data) / sizeof(data[0]);
+
+    int queries[] = {10, 35, 40, 60, 5, 70};
+    int count = sizeof(queries) / sizeof(queries[0]);
+    int answers[sizeof(queries) / sizeof(queries[0])];
+
+    batchBinarySearch(data, size, queries, count, answers);
+    for (int i = 0; i < count; i++) {
+        if (answers[i] != -1) {
+            cout << "Found " << queries[i] << " at index " << answers[i] << endl;
+        } else {
+            cout << "Value " << queries[i] << " not found in array" << endl;
+        }
+    }
+
+    // Large sorted table with unique keys and a big batch of random lookups
+    const int n = 1 << 24;        // 16M ints = 64 MB
+    const int lookups = 1 << 22;  // 4M targets
+    vector<int> sorted(n);
+    for (int i = 0; i < n; i++) sorted[i] = 3 * i + 1;
+
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(0, 3 * n);
+    vector<int> targets(lookups), batchResults(lookups), loopResults(lookups);
+    for (int& x : targets) x = dist(rng);
+
+    // One binarySearch() call per target
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++) loopResults[i] = binarySearch(sorted.data(), n, targets[i]);
+    double loopSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Whole batch at once
+    start = chrono::steady_clock::now();
+    batchBinarySearch(sorted.data(), n, targets.data(), lookups, batchResults.data());
+    double batchSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    bool same = loopResults == batchResults;
+    cout << "\nCorrectness check: " << (same ? "OK" : "MISMATCH") << endl;
+    cout << "binarySearch loop:  " << lookups / loopSeconds / 1e6 << " M lookups/s" << endl;
+    cout << "batchBinarySearch:  " << lookups / batchSeconds / 1e6 << " M lookups/s" << endl;
+    cout << "Speedup: " << loopSeconds / batchSeconds << "x" << endl;
+
+    return same ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Code Breakdown:
+ * - base[q] - start of the range still holding target q; n - its length (same for all q)
+ * - base[q] += (base[q][half] < t[q]) * half - halve the range without a branch
+ * - __builtin_prefetch(base[q] + nextHalf) - request the next probe of search q now;
+ *   it arrives while the other INTERLEAVE - 1 searches take their step
+ * - (base[q] - arr) + (*base[q] < t[q]) - lower bound, then an equality check gives -1 or index
+ *
+ * Why it is faster than calling binarySearch() in a loop:
+ * - A single binary search is a chain of dependent loads: each probe address depends on the
+ *   previous comparison, so every cache miss stalls the CPU for the full memory latency
+ * - Searches for different targets are independent, so their loads can be in flight together
+ * - With 32 searches interleaved, up to 32 misses overlap instead of happening one by one
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O(k log n) - each search still takes about log2(n) steps
+ * - Space Complexity: O(1) extra - INTERLEAVE pointers on the stack
+ *
+ * Use Cases:
+ * - Bulk key lookups (joins, filters, dictionary encoding)
+ * - Any workload that has many queries ready at the same time
+ */
@@ -18,35 +18,14 @@
  */
 
 #include <iostream>
+#include "../common/array_search.h"
 using namespace std;
 
-/**
- * Binary Search Function
- * 
- * @param arr[] - sorted input array to search in
- * @param size - size of the array
- * @param target - value to search for
- * @return index of target if found, -1 if not found
+/*
+ * binarySearch(arr, size, target) lives in common/array_search.h (shared with the benchmarks):
+ * it halves the range [left, right] of the sorted array until arr[mid] == target or the range
+ * is empty, and returns the index found, or -1.
  */
-int binarySearch(int arr[], int size, int target) {
-    int left = 0;
-    int right = size - 1;
-
-    while (left <= right) {
-        // Calculate middle point (prevents integer overflow)
-        int mid = left + (right - left) / 2;
-
-        if (arr[mid] == target) {
-            return mid; // Found: return the index
-        } else if (arr[mid] < target) {
-            left = mid + 1; // Target is in right half
-        } else {
-            right = mid - 1; // Target is in left half
-        }
-    }
-
-    return -1; // Not found: return -1
-}
 
 int main() {
     // Sample data array (MUST be sorted)
@@ -20,53 +20,41 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
+#include "../common/csr_graph.h"
+#include "../common/compressed_graph.h"
+#include "../common/search.h"
 using namespace std;
 
-/**
- * Breadth-First Search Function
- * 
- * @param start - starting node for traversal
- * @param graph - adjacency list representation of graph
- * @param visited - boolean array to track visited nodes
+/*
+ * bfs(start, graph, goal = -1) lives in common/search.h and returns a SearchResult (found, cost,
+ * path, nodes expanded). This trace policy prints every expanded node; without it (the default
+ * NoTrace) the expansion loop does no I/O.
  */
-void bfs(int start, const vector<vector<int>>& graph, vector<bool>& visited) {
-    queue<int> q;                    // Queue for BFS traversal
-    q.push(start);                   // Add starting node to queue
-    visited[start] = true;           // Mark starting node as visited
-
-    while (!q.empty()) {
-        int node = q.front();        // Get front node from queue
-        q.pop();                     // Remove front node from queue
-        cout << "Visited node: " << node << endl;
-
-        // Explore all neighbors of current node
-        for (int neighbor : graph[node]) {
-            if (!visited[neighbor]) {
-                q.push(neighbor);          // Add unvisited neighbor to queue
-                visited[neighbor] = true;  // Mark neighbor as visited
-            }
-        }
-    }
-}
+struct PrintVisits : NoTrace {
+    static void expand(const SearchStep& step) { cout << "Visited node: " << step.node << endl; }
+};
 
 int main() {
     int n = 6; // Number of nodes in graph
-    vector<vector<int>> graph(n);
+    vector<vector<int>> adjacency(n);
     
     // Create undirected graph using adjacency list
     // Each vector contains neighbors of that node
-    graph[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
-    graph[1] = {0, 3, 4}; // Node 1 connects to nodes 0, 3, and 4
-    graph[2] = {0};      // Node 2 connects to node 0
-    graph[3] = {1};      // Node 3 connects to node 1
-    graph[4] = {1, 5};   // Node 4 connects to nodes 1 and 5
-    graph[5] = {4};      // Node 5 connects to node 4
-
-    vector<bool> visited(n, false);  // Track visited nodes
+    adjacency[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
+    adjacency[1] = {0, 3, 4}; // Node 1 connects to nodes 0, 3, and 4
+    adjacency[2] = {0};      // Node 2 connects to node 0
+    adjacency[3] = {1};      // Node 3 connects to node 1
+    adjacency[4] = {1, 5};   // Node 4 connects to nodes 1 and 5
+    adjacency[5] = {4};      // Node 5 connects to node 4
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     cout << "BFS traversal starting from node 0:\n";
-    bfs(0, graph, visited);
+    bfs<PrintVisits>(0, graph);
+
+    // Same traversal on the compressed (delta + varint) representation
+    CompressedGraph compressed = CompressedGraph::fromCsr(graph);
+    cout << "\nBFS traversal on the compressed graph:\n";
+    bfs<PrintVisits>(0, compressed);
 
     return 0;
 }
@@ -82,8 +70,9 @@ int main() {
  * 
  * Data Structures Used:
  * - Queue: Stores nodes to be visited (FIFO)
- * - Vector<bool>: Tracks visited nodes to avoid cycles
- * - Adjacency List: Graph representation
+ * - Search Workspace: Epoch-stamped visited flags, hop counts and parents (common/search_workspace.h)
+ * - CSR Graph: Contiguous adjacency arrays (common/csr_graph.h)
+ * - Compressed Graph: Delta + varint neighbor lists, decoded while iterating (common/compressed_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(V + E) - visit each node and edge once
@@ -0,0 +1,415 @@
+/*
+ * PARALLEL DELTA-STEPPING SINGLE-SOURCE SHORTEST PATHS
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Multi-threaded version of ucs's "cost to every node" table
+ *
+ * Key Characteristics:
+ * - Tentative costs are grouped into buckets of width delta: bucket i holds the vertices with
+ *   cost in [i * delta, (i + 1) * delta)
+ * - Buckets are settled in increasing order, like ucs settles vertices in increasing cost, but
+ *   all vertices of one bucket are expanded at the same time by a pool of threads
+ * - Light edges (weight <= delta) can put a vertex back into the current bucket, so they are
+ *   relaxed in rounds until the bucket stays empty; heavy edges (weight > delta) always land in
+ *   a later bucket and are relaxed once, after the bucket is settled
+ * - Costs are lowered with an atomic compare-and-swap (atomic minimum); the thread that lowers a
+ *   cost files the vertex in its own bucket array, so buckets need no locks
+ * - Same cost table as ucs() of common/search.h (INT_MAX = unreachable)
+ * - delta trades work for parallelism: delta = 1 is Dijkstra (one cost per bucket, little
+ *   parallelism), delta = infinity is Bellman-Ford (one bucket, many re-relaxations)
+ *
+ * Algorithm: Meyer and Sanders, "Delta-stepping: a parallelizable shortest path algorithm"
+ *            (J. Algorithms 2003)
+ *
+ * Time Complexity: O(V + E + B * L) work per thread count with B buckets and L light rounds;
+ *                  depth O(B * L) barriers
+ * Space Complexity: O(V) - costs, plus bucket entries (one per successful relaxation)
+ *
+ * Best for: All costs from one source on large graphs with non-negative weights, many cores
+ * Worst for: A single goal (use aStar), one core (ucs does less work)
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <algorithm>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search.h"
+using namespace std;
+
+/**
+ * Cost to every node with ucs() of common/search.h (the reference), read from its workspace
+ *
+ * @param start - starting node
+ * @param graph - weighted graph in CSR form (see common/csr_graph.h)
+ * @param cost - receives the minimum cost of every node (INT_MAX = unreachable)
+ */
+void ucsCosts(int start, const CsrGraph& graph, vector<int>& cost) {
+    SearchWorkspace& workspace = SearchWorkspace::forThread();
+    ucs(start, graph, -1, workspace);
+    cost.resize(graph.numVertices());
+    for (int v = 0; v < graph.numVertices(); v++) cost[v] = workspace.cost(v);
+}
+
+/**
+ * Multi-threaded delta-stepping with a persistent thread pool
+ */
+class DeltaStepping {
+public:
+    /**
+     * Start the worker threads
+     *
+     * @param threads - total threads used per search (including the caller)
+     * @param bucketWidth - delta: cost range of one bucket (edges up to delta are "light")
+     * @param chunkSize - bucket entries claimed at a time
+     */
+    explicit DeltaStepping(int threads = thread::hardware_concurrency(), int bucketWidth = 64, int chunkSize = 256)
+        : numThreads(threads < 1 ? 1 : threads), delta(bucketWidth < 1 ? 1 : bucketWidth), chunk(chunkSize),
+          local(numThreads), counts(numThreads), offsets(numThreads) {
+        // The calling thread also works, so start one worker fewer
+        for (int t = 1; t < numThreads; t++) {
+            workers.emplace_back(&DeltaStepping::workerLoop, this, t);
+        }
+    }
+
+    ~DeltaStepping() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        startCv.notify_all();
+        for (thread& w : workers) w.join();
+    }
+
+    DeltaStepping(const DeltaStepping&) = delete;
+    DeltaStepping& operator=(const DeltaStepping&) = delete;
+
+    /**
+     * Parallel Shortest Paths Function
+     *
+     * @param start - starting node
+     * @param graph - weighted graph in CSR form (non-negative weights)
+     * @param cost - receives the minimum cost of every node (INT_MAX = unreachable), as ucs
+     */
+    void search(int start, const CsrGraph& graph, vector<int>& cost) {
+        int n = graph.numVertices();
+        cost.resize(n);
+        if ((int)dist.size() < n) dist = vector<atomic<int>>(n);  // Grows only; set to INT_MAX in work()
+        for (ThreadState& state : local) {
+            for (auto& bin : state.bins) bin.clear();
+            state.settled.clear();
+        }
+        frontier.assign(1, {start, 0});
+        frontierSize = 1;
+        bucket = 0;
+
+        {
+            lock_guard<mutex> lock(m);
+            jobGraph = &graph;
+            jobStart = start;
+            jobCost = cost.data();
+            nextClaim.store(0);
+            nextBucket.store(INT_MAX);
+            running = numThreads - 1;
+            generation++;
+        }
+        startCv.notify_all();
+
+        work(0);  // Caller works too
+
+        unique_lock<mutex> lock(m);
+        doneCv.wait(lock, [this] { return running == 0; });
+    }
+
+    int threadCount() const { return numThreads; }
+    int bucketWidth() const { return delta; }
+
+private:
+    // Bucket entry: vertex and the cost it was filed with (stale once the cost drops further)
+    struct Entry {
+        int vertex;
+        int cost;
+    };
+
+    // Per-thread buckets and the vertices this thread expanded in the current bucket
+    struct ThreadState {
+        vector<vector<Entry>> bins;  // bins[i] = entries this thread filed in bucket i
+        vector<int> settled;
+    };
+
+    /**
+     * Worker thread: wait for a new search, help with every bucket, report completion
+     */
+    void workerLoop(int id) {
+        long long seen = 0;
+        while (true) {
+            {
+                unique_lock<mutex> lock(m);
+                startCv.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            work(id);
+
+            lock_guard<mutex> lock(m);
+            if (--running == 0) doneCv.notify_one();
+        }
+    }
+
+    /**
+     * Reset this thread's share of the costs, settle buckets in increasing order until none is
+     * left, then copy the share out
+     */
+    void work(int id) {
+        const CsrGraph& graph = *jobGraph;
+        ThreadState& state = local[id];
+        int n = graph.numVertices();
+        int perThread = (n + numThreads - 1) / numThreads;
+        int first = min(n, id * perThread), last = min(n, (id + 1) * perThread);
+        for (int v = first; v < last; v++) dist[v].store(INT_MAX, memory_order_relaxed);
+        barrier([&] { dist[jobStart].store(0, memory_order_relaxed); });
+
+        while (true) {
+            // Light round: expand the current bucket's entries, relax edges of weight <= delta
+            for (int begin = nextClaim.fetch_add(chunk); begin < frontierSize; begin = nextClaim.fetch_add(chunk)) {
+                int end = min(frontierSize, begin + chunk);
+                for (int i = begin; i < end; i++) {
+                    auto [u, d] = frontier[i];
+                    if (dist[u].load(memory_order_relaxed) != d) continue;  // Stale: filed again with a lower cost
+                    state.settled.push_back(u);
+                    for (auto [neighbor, weight] : graph.edges(u)) {
+                        if (weight <= delta) relax(state, neighbor, d + weight);
+                    }
+                }
+            }
+            if (gather(id, bucket) > 0) continue;  // Light edges refilled the bucket: another round
+
+            // Bucket settled: relax heavy edges once, from every vertex expanded in it
+            for (int u : state.settled) {
+                int d = dist[u].load(memory_order_relaxed);
+                for (auto [neighbor, weight] : graph.edges(u)) {
+                    if (weight > delta) relax(state, neighbor, d + weight);
+                }
+            }
+            state.settled.clear();
+
+            // Next bucket: smallest non-empty bucket of any thread
+            for (int i = bucket + 1; i < (int)state.bins.size(); i++) {
+                if (state.bins[i].empty()) continue;
+                int current = nextBucket.load();
+                while (i < current && !nextBucket.compare_exchange_weak(current, i)) {}
+                break;
+            }
+            barrier([&] {
+                bucket = nextBucket.load();
+                nextBucket.store(INT_MAX);
+            });
+            if (bucket == INT_MAX) break;
+            gather(id, bucket);
+        }
+        for (int v = first; v < last; v++) jobCost[v] = dist[v].load(memory_order_relaxed);
+    }
+
+    /**
+     * Lower the cost of v to newCost if smaller (atomic minimum); file v in its bucket if lowered
+     */
+    void relax(ThreadState& state, int v, int newCost) {
+        int current = dist[v].load(memory_order_relaxed);
+        while (newCost < current) {
+            if (dist[v].compare_exchange_weak(current, newCost, memory_order_relaxed)) {
+                size_t b = newCost / delta;
+                if (b >= state.bins.size()) state.bins.resize(b + 1);
+                state.bins[b].push_back({v, newCost});
+                return;
+            }
+        }
+    }
+
+    /**
+     * Make every thread's entries of bucket b the new frontier
+     *
+     * @return size of the new frontier (the same in every thread)
+     */
+    int gather(int id, int b) {
+        ThreadState& state = local[id];
+        counts[id] = b < (int)state.bins.size() ? state.bins[b].size() : 0;
+
+        // The last thread to arrive computes where each thread's entries go
+        barrier([&] {
+            int total = 0;
+            for (int t = 0; t < numThreads; t++) {
+                offsets[t] = total;
+                total += counts[t];
+            }
+            if ((int)frontier.size() < total) frontier.resize(total);
+            frontierSize = total;
+            nextClaim.store(0);
+        });
+
+        if (counts[id] > 0) {
+            copy(state.bins[b].begin(), state.bins[b].end(), frontier.begin() + offsets[id]);
+            state.bins[b].clear();
+        }
+        int size = frontierSize;
+        barrier([] {});  // Frontier complete before anybody expands it
+        return size;
+    }
+
+    /**
+     * Wait until all threads arrive; the last one runs lastArrival() before releasing the others
+     */
+    template <typename Action>
+    void barrier(Action lastArrival) {
+        unique_lock<mutex> lock(m);
+        long long phase = barrierPhase;
+        if (++arrived == numThreads) {
+            lastArrival();
+            arrived = 0;
+            barrierPhase++;
+            barrierCv.notify_all();
+        } else {
+            barrierCv.wait(lock, [&] { return barrierPhase != phase; });
+        }
+    }
+
+    int numThreads;             // Threads per search, caller included
+    int delta;                  // Bucket width
+    int chunk;                  // Frontier entries per claim
+    vector<thread> workers;     // numThreads - 1 pool threads
+
+    // Current search (written before generation changes or inside a barrier)
+    const CsrGraph* jobGraph = nullptr;
+    int jobStart = 0;
+    int* jobCost = nullptr;
+    vector<atomic<int>> dist;     // Tentative costs, lowered with compare-and-swap; kept between searches
+    vector<ThreadState> local;    // One per thread
+    vector<int> counts, offsets;  // Entries each thread contributes to the frontier, and where
+    vector<Entry> frontier;       // Entries of the current bucket (first frontierSize)
+    int frontierSize = 0;
+    int bucket = 0;               // Bucket being settled (INT_MAX = done)
+    atomic<int> nextClaim{0};     // Next frontier index to hand out
+    atomic<int> nextBucket{INT_MAX};
+
+    mutex m;
+    condition_variable startCv, doneCv, barrierCv;
+    long long generation = 0;   // Incremented for every new search
+    int running = 0;            // Workers still busy with the current search
+    bool stopping = false;
+    int arrived = 0;            // Threads waiting at the barrier
+    long long barrierPhase = 0; // Incremented every time the barrier opens
+};
+
+int main(int argc, char* argv[]) {
+    int n = 6; // Number of nodes
+    vector<vector<pair<int, int>>> adjacency(n);
+
+    // Same weighted graph as uniform_const_search.cpp
+    adjacency[0] = {{1, 2}, {2, 4}};
+    adjacency[1] = {{0, 2}, {3, 7}, {4, 1}};
+    adjacency[2] = {{0, 4}, {4, 3}};
+    adjacency[3] = {{1, 7}, {5, 1}};
+    adjacency[4] = {{1, 1}, {2, 3}, {5, 5}};
+    adjacency[5] = {{3, 1}, {4, 5}};
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);
+
+    DeltaStepping small(2, 3, 1);  // delta = 3: edges 7 and 4, 5 are heavy; one-entry chunks
+    vector<int> cost;
+    small.search(0, graph, cost);
+    cout << "Delta-stepping from node 0 (delta = 3):\n";
+    for (int v = 0; v < n; v++) cout << "To node " << v << ": cost = " << cost[v] << endl;
+
+    // Strong scaling on a weighted R-MAT graph (scale 22 gives about 10^8 directed edges)
+    int scale = argc > 1 ? atoi(argv[1]) : 20;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    GeneratedGraph rmat = generateRmat(scale, 12, 255, 42);
+    int start = largestComponentVertex(rmat.graph);
+    cout << "\nR-MAT graph: " << rmat.graph.numVertices() << " vertices, " << rmat.graph.numEdges()
+         << " edges, weights 1..255\n";
+
+    vector<int> expected;
+    auto begin = chrono::steady_clock::now();
+    ucsCosts(start, rmat.graph, expected);
+    double serial = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    cout << "  serial ucs: " << serial * 1000 << " ms\n";
+
+    // Correctness against ucs() for several thread counts and bucket widths
+    vector<int> smallExpected;
+    ucsCosts(0, graph, smallExpected);
+    bool ok = true;
+    for (int threads : {1, 2, 3, 8}) {
+        for (int width : {1, 32, 1000}) {
+            DeltaStepping searcher(threads, width, 64);
+            searcher.search(start, rmat.graph, cost);
+            ok = ok && cost == expected;
+            searcher.search(0, graph, cost);  // Smaller graph: the cost array is reused
+            ok = ok && cost == smallExpected;
+        }
+    }
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    for (int width : {16, 64, 256}) {
+        cout << "  delta = " << width << ":\n";
+        double single = 0;
+        for (int threads : threadCounts) {
+            DeltaStepping searcher(threads, width);
+            double best = 1e30;
+            for (int r = 0; r < 3; r++) {
+                begin = chrono::steady_clock::now();
+                searcher.search(start, rmat.graph, cost);
+                best = min(best, chrono::duration<double>(chrono::steady_clock::now() - begin).count());
+            }
+            if (threads == 1) single = best;
+            cout << "    " << threads << " thread(s): " << best * 1000 << " ms, speedup " << single / best
+                 << "x (vs ucs " << serial / best << "x)\n";
+        }
+    }
+
+    return ok ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Code Breakdown:
+ * - relax() - atomic minimum: compare_exchange_weak retries only while the new cost is still
+ *   smaller; the winner files (vertex, cost) in its own bins, so filing needs no lock
+ * - Stale entries - a vertex filed several times is expanded only for the entry whose cost is
+ *   still current (dist[u] == entry cost)
+ * - gather() - every thread reports how many entries it holds for the bucket; the last thread
+ *   at the barrier computes offsets, then every thread copies its entries without contention
+ * - nextBucket - atomic minimum over each thread's first non-empty bin after the current one
+ *
+ * Choosing delta:
+ * - Around the average edge weight (or max weight / average degree) works well: buckets hold
+ *   enough vertices for all threads while few vertices are expanded more than once
+ * - Smaller delta: more buckets and barriers, less wasted work
+ * - Larger delta: fewer barriers, more re-relaxations of light edges
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O((V + E) / p + B * L) per search with p threads, B non-empty buckets and
+ *   L light rounds per bucket, plus the re-relaxations of vertices settled too early
+ * - Space Complexity: O(V) costs (kept between searches, reallocated only when V grows) plus
+ *   one bucket entry per successful relaxation
+ *
+ * Performance Notes:
+ * - Like BFS, SSSP is memory-latency bound; speedup follows the memory system, not only cores
+ * - On one core, ucs wins: delta-stepping does extra relaxations and pays for barriers
+ *
+ * Use Cases:
+ * - Nightly all-distances jobs on graphs with hundreds of millions of edges
+ * - Any ucs call that needs the whole cost table rather than a path to one goal
+ */
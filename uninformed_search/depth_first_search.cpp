@@ -12,7 +12,7 @@
  * - Explores one complete path before backtracking
  * 
  * Time Complexity: O(V + E) - where V = vertices, E = edges
- * Space Complexity: O(V) - recursion stack depth in worst case
+ * Space Complexity: O(V) - explicit stack depth in worst case
  * 
  * Best for: Complete exploration, cycle detection, maze solving
  * Worst for: Finding shortest path (use BFS instead)
@@ -20,43 +20,41 @@
 
 #include <iostream>
 #include <vector>
+#include "../common/csr_graph.h"
+#include "../common/compressed_graph.h"
+#include "../common/search.h"
 using namespace std;
 
-/**
- * Depth-First Search Function (Recursive Implementation)
- * 
- * @param node - current node being visited
- * @param graph - adjacency list representation of graph
- * @param visited - boolean array to track visited nodes
+/*
+ * dfs(start, graph, goal = -1) lives in common/search.h and returns a SearchResult (found, cost,
+ * path, nodes expanded). It runs on the iterative DFS engine (common/dfs_engine.h): the current
+ * path is a heap-allocated stack of (node, next neighbor) frames, so paths millions of nodes
+ * deep cannot overflow the native call stack. This trace policy prints every expanded node.
  */
-void dfs(int node, const vector<vector<int>>& graph, vector<bool>& visited) {
-    visited[node] = true;                    // Mark current node as visited
-    cout << "Visited node: " << node << endl;
-
-    // Explore all neighbors of current node
-    for (int neighbor : graph[node]) {
-        if (!visited[neighbor]) {
-            dfs(neighbor, graph, visited);   // Recursive call - go deep first
-        }
-    }
-}
+struct PrintVisits : NoTrace {
+    static void expand(const SearchStep& step) { cout << "Visited node: " << step.node << endl; }
+};
 
 int main() {
     int n = 6; // Number of nodes in graph
-    vector<vector<int>> graph(n);
+    vector<vector<int>> adjacency(n);
     
     // Create undirected graph using adjacency list
-    graph[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
-    graph[1] = {0, 3, 4}; // Node 1 connects to nodes 0, 3, and 4
-    graph[2] = {0};      // Node 2 connects to node 0
-    graph[3] = {1};      // Node 3 connects to node 1
-    graph[4] = {1, 5};   // Node 4 connects to nodes 1 and 5
-    graph[5] = {4};      // Node 5 connects to node 4
-
-    vector<bool> visited(n, false);  // Track visited nodes
+    adjacency[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
+    adjacency[1] = {0, 3, 4}; // Node 1 connects to nodes 0, 3, and 4
+    adjacency[2] = {0};      // Node 2 connects to node 0
+    adjacency[3] = {1};      // Node 3 connects to node 1
+    adjacency[4] = {1, 5};   // Node 4 connects to nodes 1 and 5
+    adjacency[5] = {4};      // Node 5 connects to node 4
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     cout << "DFS traversal starting from node 0:\n";
-    dfs(0, graph, visited);
+    dfs<PrintVisits>(0, graph);
+
+    // Same traversal on the compressed (delta + varint) representation
+    CompressedGraph compressed = CompressedGraph::fromCsr(graph);
+    cout << "\nDFS traversal on the compressed graph:\n";
+    dfs<PrintVisits>(0, compressed);
 
     return 0;
 }
@@ -71,28 +69,31 @@ int main() {
  * - Memory efficient for deep graphs
  * 
  * Data Structures Used:
- * - Stack (implicit in recursion): Stores nodes to be visited (LIFO)
- * - Vector<bool>: Tracks visited nodes to avoid cycles
- * - Adjacency List: Graph representation
+ * - Explicit Stack: Contiguous (node, next neighbor) frames of the current path (common/dfs_engine.h)
+ * - Search Workspace: Epoch-stamped visited flags (common/search_workspace.h)
+ * - CSR Graph: Contiguous adjacency arrays (common/csr_graph.h)
+ * - Compressed Graph: Delta + varint neighbor lists, decoded while iterating (common/compressed_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(V + E) - visit each node and edge once
- * - Space Complexity: O(V) - recursion stack depth in worst case
+ * - Space Complexity: O(V) - stack depth in worst case (8-byte frames on CSR)
  * 
  * Advantages:
  * - Memory efficient for deep graphs
  * - Good for complete exploration
  * - Natural for recursive problems
+ * - No stack overflow: the iterative engine handles paths millions of nodes deep
  * - Can detect cycles easily
  * 
  * Disadvantages:
  * - May not find shortest path
  * - Can get stuck in deep paths
- * - Stack overflow for very deep graphs
+ * - Deep paths need O(depth) stack memory (heap, not the native call stack)
  * 
  * Use Cases:
  * - Maze solving
- * - Topological sorting
+ * - Topological sorting (topologicalOrder in common/dfs_engine.h)
+ * - Strongly connected components (stronglyConnectedComponents in common/dfs_engine.h)
  * - Cycle detection
  * - Game tree exploration
  * - Web crawling (alternative to BFS)
@@ -0,0 +1,245 @@
+/*
+ * DIRECTION-OPTIMIZING BREADTH-FIRST SEARCH
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: BFS that switches between top-down and bottom-up steps depending on frontier size
+ *
+ * Key Characteristics:
+ * - Top-down step (classic BFS): every frontier vertex scans its edges for unvisited neighbors
+ * - Bottom-up step: every UNVISITED vertex scans its edges for a parent in the frontier and
+ *   stops at the first one found
+ * - On low-diameter graphs (social networks, web graphs) the middle levels hold most of the
+ *   vertices; there a top-down step inspects almost every edge only to find visited targets,
+ *   while a bottom-up step stops after one hit per vertex
+ * - Frontier and visited sets are bitmaps (1 bit per vertex) during bottom-up steps
+ * - Same levels as bfs() in breadth_first_search.cpp
+ *
+ * Switching rule (Beamer, Asanovic, Patterson, "Direction-Optimizing Breadth-First Search"):
+ * - top-down -> bottom-up when edges to check from the frontier (mf) > unexplored edges (mu) / ALPHA
+ * - bottom-up -> top-down when the frontier shrinks below V / BETA vertices
+ *
+ * Time Complexity: O(V + E) worst case, far fewer edge inspections on power-law graphs
+ * Space Complexity: O(V) - level array, queues and two bitmaps of V bits
+ *
+ * Best for: Full traversals of large low-diameter graphs
+ * Worst for: High-diameter graphs (grids, road networks) - the frontier never gets large,
+ *            so every step stays top-down
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+using namespace std;
+
+/**
+ * Set of vertices stored as one bit per vertex
+ */
+class Bitmap {
+public:
+    explicit Bitmap(int n) : words((n + 63) / 64, 0) {}
+
+    bool test(int v) const { return (words[v >> 6] >> (v & 63)) & 1; }
+    void set(int v) { words[v >> 6] |= uint64_t(1) << (v & 63); }
+    void clear() { fill(words.begin(), words.end(), 0); }
+    void swap(Bitmap& other) { words.swap(other.words); }
+
+private:
+    vector<uint64_t> words;
+};
+
+// Edge inspections and step directions of one search
+struct BfsStats {
+    long long edgesInspected = 0;
+    int topDownSteps = 0;
+    int bottomUpSteps = 0;
+};
+
+const int ALPHA = 15;  // Go bottom-up when frontier edges exceed unexplored edges / ALPHA
+const int BETA = 18;   // Go back top-down when the frontier has fewer than V / BETA vertices
+
+/**
+ * Direction-Optimizing BFS Function
+ *
+ * @param start - starting node for traversal
+ * @param graph - graph in CSR form (see common/csr_graph.h); out-edges for top-down steps
+ * @param incoming - in-edges for bottom-up steps (pass graph again for undirected graphs)
+ * @param stats - receives edge inspections and step counts (may be nullptr)
+ * @return level[v] = hop distance from start, -1 if unreachable
+ */
+vector<int> directionOptimizingBfs(int start, const CsrGraph& graph, const CsrGraph& incoming,
+                                   BfsStats* stats = nullptr) {
+    int n = graph.numVertices();
+    BfsStats local;
+    BfsStats& s = stats ? *stats : local;
+
+    vector<int> level(n, -1);
+    Bitmap visited(n), frontierBits(n), nextBits(n);
+    vector<int> frontier = {start}, next;
+    level[start] = 0;
+    visited.set(start);
+
+    long long unexploredEdges = graph.numEdges() - graph.degree(start);  // mu
+    long long frontierEdges = graph.degree(start);                       // mf
+    bool bottomUp = false;
+
+    for (int depth = 0; !frontier.empty(); depth++) {
+        // Choose the direction of this step
+        if (!bottomUp && frontierEdges > unexploredEdges / ALPHA) {
+            bottomUp = true;
+            frontierBits.clear();
+            for (int v : frontier) frontierBits.set(v);
+        } else if (bottomUp && (long long)frontier.size() < n / BETA) {
+            bottomUp = false;
+        }
+
+        next.clear();
+        frontierEdges = 0;
+        if (bottomUp) {
+            // Every unvisited vertex looks for a parent in the frontier
+            s.bottomUpSteps++;
+            nextBits.clear();
+            for (int v = 0; v < n; v++) {
+                if (visited.test(v)) continue;
+                for (int parent : incoming.neighbors(v)) {
+                    s.edgesInspected++;
+                    if (frontierBits.test(parent)) {
+                        level[v] = depth + 1;
+                        nextBits.set(v);
+                        next.push_back(v);
+                        break;  // One parent is enough
+                    }
+                }
+            }
+            for (int v : next) visited.set(v);  // After the scan: v must not act as a parent this step
+            frontierBits.swap(nextBits);
+        } else {
+            // Every frontier vertex pushes to its unvisited neighbors
+            s.topDownSteps++;
+            for (int node : frontier) {
+                for (int neighbor : graph.neighbors(node)) {
+                    s.edgesInspected++;
+                    if (!visited.test(neighbor)) {
+                        visited.set(neighbor);
+                        level[neighbor] = depth + 1;
+                        next.push_back(neighbor);
+                    }
+                }
+            }
+        }
+
+        for (int v : next) {
+            frontierEdges += graph.degree(v);
+            unexploredEdges -= graph.degree(v);
+        }
+        frontier.swap(next);
+    }
+    return level;
+}
+
+/**
+ * Top-down BFS levels (reference, same loop as bfs() in breadth_first_search.cpp)
+ */
+vector<int> topDownBfs(int start, const CsrGraph& graph, BfsStats& stats) {
+    vector<int> level(graph.numVertices(), -1);
+    queue<int> q;
+    q.push(start);
+    level[start] = 0;
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        for (int neighbor : graph.neighbors(node)) {
+            stats.edgesInspected++;
+            if (level[neighbor] == -1) {
+                level[neighbor] = level[node] + 1;
+                q.push(neighbor);
+            }
+        }
+    }
+    return level;
+}
+
+int main(int argc, char* argv[]) {
+    int n = 6; // Number of nodes in graph
+    vector<vector<int>> adjacency(n);
+
+    // Same undirected graph as breadth_first_search.cpp
+    adjacency[0] = {1, 2};
+    adjacency[1] = {0, 3, 4};
+    adjacency[2] = {0};
+    adjacency[3] = {1};
+    adjacency[4] = {1, 5};
+    adjacency[5] = {4};
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);
+
+    cout << "Direction-optimizing BFS levels from node 0:\n";
+    vector<int> level = directionOptimizingBfs(0, graph, graph);
+    for (int v = 0; v < n; v++) cout << "Node " << v << ": level " << level[v] << endl;
+
+    // Power-law graph (R-MAT, common/graph_generators.h): compare with top-down BFS
+    int scale = argc > 1 ? atoi(argv[1]) : 20;
+    GeneratedGraph rmat = generateRmat(scale, 16, 1, 42);
+    int start = largestComponentVertex(rmat.graph);
+    cout << "\nR-MAT graph: " << rmat.graph.numVertices() << " vertices, "
+         << rmat.graph.numEdges() << " edges\n";
+
+    BfsStats topDown, optimized;
+    auto begin = chrono::steady_clock::now();
+    vector<int> expected = topDownBfs(start, rmat.graph, topDown);
+    double topDownMs = chrono::duration<double>(chrono::steady_clock::now() - begin).count() * 1000;
+    begin = chrono::steady_clock::now();
+    vector<int> levels = directionOptimizingBfs(start, rmat.graph, rmat.graph, &optimized);
+    double optimizedMs = chrono::duration<double>(chrono::steady_clock::now() - begin).count() * 1000;
+
+    bool same = levels == expected;
+    cout << "Correctness check: " << (same ? "OK" : "MISMATCH") << endl;
+    cout << "  Top-down:             " << topDownMs << " ms, " << topDown.edgesInspected << " edges inspected\n";
+    cout << "  Direction-optimizing: " << optimizedMs << " ms, " << optimized.edgesInspected
+         << " edges inspected (" << optimized.topDownSteps << " top-down, "
+         << optimized.bottomUpSteps << " bottom-up steps)\n";
+    cout << "  Edge inspections reduced " << (double)topDown.edgesInspected / optimized.edgesInspected << "x\n";
+
+    return same ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Key Features:
+ * - Top-down steps while the frontier is small (first and last levels)
+ * - Bottom-up steps while the frontier is large (middle levels of low-diameter graphs)
+ * - Same BFS levels as the purely top-down version
+ *
+ * Data Structures Used:
+ * - Vector<int> frontier / next: Vertices of the current and next level (queue of one level)
+ * - Bitmap frontierBits: Frontier membership test for bottom-up steps (V bits)
+ * - Bitmap visited: Visited set (V bits, 8x smaller than one byte per vertex)
+ * - CSR Graph: Contiguous adjacency arrays (common/csr_graph.h)
+ *
+ * Switching Heuristic:
+ * - mf = edges leaving the frontier, mu = edges leaving unvisited vertices
+ * - mf > mu / ALPHA: a top-down step would inspect many edges; bottom-up is cheaper because each
+ *   unvisited vertex stops at its first frontier neighbor
+ * - frontier < V / BETA: a bottom-up step would scan all V vertices for a handful of parents
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O(V + E) worst case; bottom-up steps cost O(V) plus the edges scanned
+ *   before the first hit
+ * - Space Complexity: O(V)
+ *
+ * Advantages:
+ * - An order of magnitude fewer edge inspections on power-law graphs
+ * - Bitmaps keep the visited and frontier tests in cache
+ *
+ * Disadvantages:
+ * - Directed graphs need the reverse graph for bottom-up steps
+ * - No gain on high-diameter graphs (the frontier stays small)
+ *
+ * Use Cases:
+ * - Social network analysis (hop distances, connected components)
+ * - Graph500-style traversals
+ */
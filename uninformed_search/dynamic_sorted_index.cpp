@@ -0,0 +1,322 @@
+/*
+ * DYNAMIC SORTED INDEX (LOG-STRUCTURED SORTED RUNS)
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Sorted container that accepts inserts and still answers lookups with Binary Search
+ *
+ * Key Characteristics:
+ * - New keys go into a small sorted insert buffer
+ * - A full buffer is sealed into an immutable sorted run
+ * - Runs of similar size are merged (like carries in a binary counter), so there are
+ *   only O(log n) runs and every key is merged O(log n) times
+ * - Merging can run on a background thread; inserts and lookups keep going meanwhile
+ * - Lookup = search the buffer, then binarySearch() each run, smallest (newest) first,
+ *   skipping runs whose [min, max] range cannot hold the key
+ *
+ * Time Complexity: O(log n) amortized per insert, O(log^2 n) worst case per lookup
+ * Space Complexity: O(n)
+ *
+ * Best for: Sorted data that keeps growing (logs, events, IDs) and is searched all the time
+ * Worst for: Static data (a single sorted array / Eytzinger index is faster)
+ */
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include "../common/array_search.h"
+using namespace std;
+
+/**
+ * Log-structured set of sorted runs with an insert buffer (multiset of ints)
+ *
+ * Runs are immutable and shared through shared_ptr; the list of runs is replaced
+ * (copy-on-write) whenever it changes, so a lookup only needs a brief lock to take
+ * a snapshot of it and then searches without holding the lock.
+ */
+class DynamicSortedIndex {
+public:
+    using Run = vector<int>;
+    using RunList = vector<shared_ptr<const Run>>;  // Largest (oldest) first
+
+    /**
+     * @param backgroundMerge - merge runs on a background thread (false: merge inside insert())
+     * @param bufferSize - keys held in the insert buffer before it becomes a run
+     */
+    explicit DynamicSortedIndex(bool backgroundMerge = true, int bufferSize = 1024)
+        : background(backgroundMerge), capacity(bufferSize), runs(make_shared<const RunList>()) {
+        buffer.reserve(capacity);
+        if (background) merger = thread(&DynamicSortedIndex::mergeLoop, this);
+    }
+
+    ~DynamicSortedIndex() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        workCv.notify_all();
+        if (merger.joinable()) merger.join();
+    }
+
+    DynamicSortedIndex(const DynamicSortedIndex&) = delete;
+    DynamicSortedIndex& operator=(const DynamicSortedIndex&) = delete;
+
+    /**
+     * Insert a key (duplicates are kept)
+     *
+     * @param key - value to insert
+     */
+    void insert(int key) {
+        unique_lock<mutex> lock(m);
+        buffer.insert(upper_bound(buffer.begin(), buffer.end(), key), key);  // O(bufferSize) shift
+        count++;
+        if ((int)buffer.size() < capacity) return;
+
+        // Seal the buffer as a new (smallest) run
+        auto sealed = make_shared<const Run>(move(buffer));
+        buffer = Run();
+        buffer.reserve(capacity);
+        auto next = make_shared<RunList>(*runs);
+        next->push_back(sealed);
+        runs = next;
+
+        if (background) {
+            workCv.notify_one();
+            // Back-pressure: do not let unmerged runs pile up faster than the merger works
+            doneCv.wait(lock, [this] { return runs->size() <= MAX_RUNS || stopping; });
+        } else {
+            while (mergeOnce(lock)) {
+            }
+        }
+    }
+
+    /**
+     * Check whether a key is present
+     *
+     * @param key - value to search for
+     * @return true if key was inserted
+     */
+    bool contains(int key) const {
+        shared_ptr<const RunList> snapshot;
+        {
+            lock_guard<mutex> lock(m);
+            if (binarySearch(buffer.data(), buffer.size(), key) != -1) return true;
+            snapshot = runs;
+        }
+        // Smallest (newest) runs first: they are cheap and likely hot in cache
+        for (auto it = snapshot->rbegin(); it != snapshot->rend(); ++it) {
+            const Run& run = **it;
+            if (key < run.front() || key > run.back()) continue;  // Outside this run's key range
+            if (binarySearch(run.data(), run.size(), key) != -1) return true;
+        }
+        return false;
+    }
+
+    long long size() const {
+        lock_guard<mutex> lock(m);
+        return count;
+    }
+
+    int runCount() const {
+        lock_guard<mutex> lock(m);
+        return runs->size();
+    }
+
+    /**
+     * Block until the background merger has nothing left to do
+     */
+    void waitForMerges() {
+        unique_lock<mutex> lock(m);
+        doneCv.wait(lock, [this] { return !merging && pickMerge(*runs) < 0; });
+    }
+
+private:
+    // Hard limit on runs before insert() waits for the background merger
+    static const size_t MAX_RUNS = 48;
+
+    /**
+     * Merge policy: merge the last pair runs[i], runs[i+1] where the newer run has at least
+     * half the size of the older one. Keeps run sizes roughly doubling => O(log n) runs.
+     *
+     * @return index i of the older run of the pair, or -1 if nothing needs merging
+     */
+    static int pickMerge(const RunList& list) {
+        for (int i = (int)list.size() - 2; i >= 0; i--) {
+            if (2 * list[i + 1]->size() >= list[i]->size()) return i;
+        }
+        return -1;
+    }
+
+    /**
+     * Merge one pair of runs; the merge itself runs without holding the lock
+     *
+     * @param lock - held on entry and on exit
+     * @return true if a pair was merged
+     */
+    bool mergeOnce(unique_lock<mutex>& lock) {
+        if (merging) return false;  // Another thread is already merging
+        int i = pickMerge(*runs);
+        if (i < 0) return false;
+        shared_ptr<const Run> older = (*runs)[i], newer = (*runs)[i + 1];
+        merging = true;
+
+        lock.unlock();
+        auto merged = make_shared<Run>(older->size() + newer->size());
+        std::merge(older->begin(), older->end(), newer->begin(), newer->end(), merged->begin());
+        lock.lock();
+
+        // Only new runs were appended meanwhile, so the pair is still at i, i + 1
+        auto next = make_shared<RunList>(*runs);
+        (*next)[i] = merged;
+        next->erase(next->begin() + i + 1);
+        runs = next;
+        merging = false;
+        doneCv.notify_all();
+        return true;
+    }
+
+    /**
+     * Background merger thread
+     */
+    void mergeLoop() {
+        unique_lock<mutex> lock(m);
+        while (true) {
+            workCv.wait(lock, [this] { return stopping || pickMerge(*runs) >= 0; });
+            if (stopping) return;
+            while (!stopping && mergeOnce(lock)) {
+            }
+        }
+    }
+
+    bool background;                    // Merges on the merger thread?
+    int capacity;                       // Insert buffer size
+    Run buffer;                         // Sorted, newest keys
+    shared_ptr<const RunList> runs;     // Immutable snapshot of the sorted runs
+    long long count = 0;                // Keys inserted
+
+    mutable mutex m;
+    condition_variable workCv, doneCv;
+    thread merger;
+    bool merging = false;
+    bool stopping = false;
+};
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile bool benchmarkSink;
+
+/**
+ * Insert keys into a dynamic index, then compare its lookups with binarySearch()
+ * on one fully sorted array holding the same keys
+ *
+ * @param label - name of the data set
+ * @param keys - keys in insertion order
+ * @return number of wrong answers
+ */
+int runDataset(const char* label, const vector<int>& keys) {
+    int n = keys.size();
+    DynamicSortedIndex index;
+    auto start = chrono::steady_clock::now();
+    for (int k : keys) index.insert(k);
+    double insertSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    index.waitForMerges();
+
+    vector<int> all = keys;
+    sort(all.begin(), all.end());
+    const int queries = 1 << 20;
+    mt19937 rng(7);
+    vector<int> targets(queries);
+    for (int& t : targets) t = all[rng() % n] + (int)(rng() % 2);  // Hits and misses
+
+    int mismatches = 0;
+    for (int t : targets) {
+        if (index.contains(t) != (binarySearch(all.data(), n, t) != -1)) mismatches++;
+    }
+
+    start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = binarySearch(all.data(), n, t) != -1;
+    double single = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = index.contains(t);
+    double dynamic = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "\n" << label << ": " << n << " inserts, " << insertSeconds * 1e9 / n << " ns/insert, "
+         << index.runCount() << " runs\n"
+         << "  lookup: single sorted array " << single * 1e9 / queries << " ns, dynamic index "
+         << dynamic * 1e9 / queries << " ns\n"
+         << "  correctness: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+    return mismatches;
+}
+
+int main() {
+    // Same values as binary_search.cpp, inserted in any order
+    DynamicSortedIndex small(false, 2);
+    for (int key : {40, 10, 60, 30, 20, 50}) small.insert(key);
+    cout << "Sample index: " << small.size() << " keys in " << small.runCount() << " run(s)\n";
+    for (int target : {10, 40, 60, 35}) {
+        cout << "contains(" << target << ") = " << (small.contains(target) ? "true" : "false") << endl;
+    }
+
+    const int n = 1 << 22; // 4M inserts per data set
+    mt19937 rng(42);
+    int mismatches = 0;
+
+    // Random keys: every run covers the whole key range
+    vector<int> randomKeys(n);
+    for (int& k : randomKeys) k = rng() % 100000000;
+    mismatches += runDataset("Random keys", randomKeys);
+
+    // Mostly increasing keys (timestamps with some late arrivals)
+    vector<int> timeKeys(n);
+    for (int i = 0; i < n; i++) timeKeys[i] = 20 * i + (int)(rng() % 2000);
+    mismatches += runDataset("Mostly increasing keys", timeKeys);
+
+    // Baseline: keep one sorted array up to date (every insert shifts the tail)
+    const int baselineInserts = 1 << 17;
+    vector<int> sortedArray;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < baselineInserts; i++) {
+        sortedArray.insert(upper_bound(sortedArray.begin(), sortedArray.end(), randomKeys[i]), randomKeys[i]);
+    }
+    double baselineSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "\nSorted-array insert baseline (only " << baselineInserts << " random keys): "
+         << baselineSeconds * 1e9 / baselineInserts << " ns/insert\n";
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Structure (like the carries of a binary counter):
+ * - buffer: up to B newest keys, kept sorted
+ * - runs: sorted immutable arrays, sizes roughly B, 2B, 4B, ... from newest to oldest
+ * - When the buffer is full it becomes a run; runs of similar size are merged into one
+ *
+ * Code Breakdown:
+ * - insert(): sorted insert into the small buffer; sealing a full buffer is O(1)
+ * - pickMerge(): merge when a newer run is at least half the size of the older one
+ * - mergeOnce(): std::merge of two runs WITHOUT holding the lock, then a copy-on-write
+ *   swap of the run list, so lookups never wait for a merge
+ * - contains(): take a snapshot of the run list, binarySearch() each run, newest first;
+ *   runs whose first/last key exclude the target are skipped. For mostly increasing keys
+ *   (timestamps, IDs) run ranges barely overlap, so a lookup is about one binarySearch()
+ *
+ * Complexity Analysis:
+ * - Insert: O(log n) amortized - each key is copied once per merge level
+ * - Lookup: O(log n) per run, O(log n) runs => O(log^2 n) worst case
+ * - Space Complexity: O(n), plus a temporary copy of the runs being merged
+ *
+ * Comparison with one sorted array:
+ * - Sorted array insert: O(n) shift per insert (or re-sort / rebuild)
+ * - Dynamic index insert: O(log n) amortized, lookups a few times slower than one array
+ *
+ * Use Cases:
+ * - Append-heavy indexes (time series, event logs)
+ * - LSM-tree style storage engines
+ */
@@ -0,0 +1,204 @@
+/*
+ * EYTZINGER BINARY SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Binary Search over a copy of the sorted array stored in Eytzinger (BFS / heap) order
+ *
+ * Key Characteristics:
+ * - Sorted array is re-laid out once like a binary heap: root at 1, children of k at 2k and 2k+1
+ * - The first levels of the search share a few cache lines, so they stay hot in cache
+ * - Branchless loop: k = 2k + (key[k] < target), no unpredictable if/else per level
+ * - Prefetches the node 4 levels ahead (16 descendants = one 64-byte cache line)
+ * - Results are mapped back to the index in the ORIGINAL sorted array
+ *
+ * Time Complexity: O(log n) per lookup, O(n) to build the index
+ * Space Complexity: O(n) - layout copy plus index map
+ *
+ * Best for: Many lookups into large (bigger than L2 cache) sorted arrays
+ * Worst for: Arrays that change often (index must be rebuilt) or single lookups
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include "../common/array_search.h"
+using namespace std;
+
+/**
+ * Prebuilt Eytzinger search index over a sorted array
+ *
+ * keys[1..n] hold the sorted values in BFS order (keys[0] is unused padding),
+ * rank[k] is the position of keys[k] in the original sorted array.
+ */
+class EytzingerIndex {
+public:
+    /**
+     * Build the index from a sorted array
+     *
+     * @param arr[] - sorted input array
+     * @param size - size of the array
+     */
+    EytzingerIndex(const int arr[], int size) : n(size), rank(size + 1, -1) {
+        // 64-byte aligned so that keys[16k .. 16k+15] is exactly one cache line
+        size_t bytes = ((size_t)(size + 1) * sizeof(int) + 63) / 64 * 64;
+        keys = static_cast<int*>(aligned_alloc(64, bytes));
+        keys[0] = 0;
+
+        int next = 0; // Next element of the sorted array to place
+        build(arr, next, 1);
+    }
+
+    ~EytzingerIndex() { free(keys); }
+
+    EytzingerIndex(const EytzingerIndex&) = delete;
+    EytzingerIndex& operator=(const EytzingerIndex&) = delete;
+
+    /**
+     * Lower bound: first position whose value is >= target
+     *
+     * @param target - value to search for
+     * @return index in the original sorted array, or size if every value is smaller
+     */
+    int lowerBound(int target) const {
+        int k = 1;
+        while (k <= n) {
+            __builtin_prefetch(keys + (size_t)k * 16);  // Descendant 4 levels down (one cache line)
+            k = 2 * k + (keys[k] < target);     // Branchless step: left child or right child
+        }
+        // Undo the trailing right turns (plus one left turn) to get the answer node
+        k >>= __builtin_ffs(~k);
+        return k == 0 ? n : rank[k];
+    }
+
+    /**
+     * Exact-match search with binarySearch() semantics
+     *
+     * @param target - value to search for
+     * @return index of target in the original sorted array if found, -1 if not found
+     *         (the first occurrence when the array has duplicates)
+     */
+    int find(int target) const {
+        int k = 1;
+        while (k <= n) {
+            __builtin_prefetch(keys + (size_t)k * 16);
+            k = 2 * k + (keys[k] < target);
+        }
+        k >>= __builtin_ffs(~k);
+        return (k != 0 && keys[k] == target) ? rank[k] : -1;
+    }
+
+    int size() const { return n; }
+
+private:
+    /**
+     * In-order walk of the implicit tree: filling nodes in in-order visits them in sorted order
+     *
+     * @param arr[] - sorted input array
+     * @param next - next unplaced element of arr
+     * @param k - current node of the implicit tree
+     */
+    void build(const int arr[], int& next, int k) {
+        if (k > n) return;
+        build(arr, next, 2 * k);      // Left subtree: smaller values
+        keys[k] = arr[next];
+        rank[k] = next++;
+        build(arr, next, 2 * k + 1);  // Right subtree: larger values
+    }
+
+    int n;             // Number of keys
+    int* keys;         // Values in Eytzinger order, 1-indexed
+    vector<int> rank;  // Eytzinger position -> index in the sorted array
+};
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile int benchmarkSink;
+
+int main() {
+    // Sample data array (MUST be sorted) - same example as binary_search.cpp
+    int data[] = {10, 20, 30, 40, 50, 60};
+    int size = sizeof(data) / sizeof(data[0]);
+
+    EytzingerIndex small(data, size);
+    for (int target : {10, 40, 60, 35}) {
+        int result = small.find(target);
+        if (result != -1) {
+            cout << "Found " << target << " at index " << result << endl;
+        } else {
+            cout << "Value " << target << " not found in array" << endl;
+        }
+    }
+
+    // Large sorted table with unique keys (well beyond L2 cache)
+    const int n = 1 << 24; // 16M ints = 64 MB
+    vector<int> sorted(n);
+    for (int i = 0; i < n; i++) sorted[i] = 3 * i + 1;
+
+    auto buildStart = chrono::steady_clock::now();
+    EytzingerIndex index(sorted.data(), n);
+    double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - buildStart).count();
+    cout << "\nBuilt Eytzinger index over " << n << " keys in " << buildSeconds << " s" << endl;
+
+    // Random queries: about half hit, half miss
+    const int queries = 1 << 22;
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(0, 3 * n);
+    vector<int> targets(queries);
+    for (int& t : targets) t = dist(rng);
+
+    // Correctness: same answer as binarySearch() for every query
+    int mismatches = 0;
+    for (int i = 0; i < 100000; i++) {
+        if (index.find(targets[i]) != binarySearch(sorted.data(), n, targets[i])) mismatches++;
+    }
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    // Throughput: classic branchy binary search vs Eytzinger index
+    auto start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = binarySearch(sorted.data(), n, t);
+    double classic = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = index.find(t);
+    double eytzinger = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "binarySearch:   " << classic * 1e9 / queries << " ns/lookup" << endl;
+    cout << "EytzingerIndex: " << eytzinger * 1e9 / queries << " ns/lookup" << endl;
+    cout << "Speedup: " << classic / eytzinger << "x" << endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Layout Example (sorted array 10 20 30 40 50 60):
+ * - Eytzinger order: [_, 40, 20, 60, 10, 30, 50]
+ * - Node k has children 2k and 2k+1, exactly like a binary heap
+ *
+ * Code Breakdown:
+ * - k = 2 * k + (keys[k] < target) - go left or right without a branch
+ * - __builtin_prefetch(keys + k * 16) - load the cache line holding the 16 descendants of k
+ *   four levels down, so memory latency overlaps with the next 4 steps
+ * - k >>= __builtin_ffs(~k) - drop the right turns taken after the last left turn; the
+ *   node where we last went left is the smallest value >= target
+ * - rank[k] - map back to the index in the original sorted array
+ *
+ * Complexity Analysis:
+ * - Build: O(n) time, O(n) extra space (keys + rank)
+ * - Lookup: O(log n) time, always exactly floor(log2 n) + 1 iterations
+ * - Space Complexity: O(n) - about 2x the size of the sorted array
+ *
+ * Why it is faster than binarySearch():
+ * - binarySearch() jumps across the whole array, so every level below the cache size is a
+ *   cache miss that must complete before the next address is known
+ * - The branch (arr[mid] < target) is taken ~50% of the time, so it is mispredicted often
+ * - Eytzinger order keeps the top levels packed together, prefetching overlaps the misses
+ *   of the lower levels, and the loop has no data-dependent branch
+ *
+ * Use Cases:
+ * - Large read-only sorted tables with many lookups
+ * - Database indexes and lookup tables
+ */
@@ -12,7 +12,7 @@
  * - Also known as Iterative Deepening DFS (IDDFS)
  * 
  * Time Complexity: O(b^d) - where b = branching factor, d = depth
- * Space Complexity: O(d) - recursion stack depth
+ * Space Complexity: O(d) - DFS stack depth
  * 
  * Best for: Memory-constrained environments requiring optimal paths
  * Worst for: Very deep graphs (repeated work)
@@ -20,83 +20,57 @@
 
 #include <iostream>
 #include <vector>
+#include "../common/csr_graph.h"
+#include "../common/compressed_graph.h"
+#include "../common/search.h"
 using namespace std;
 
-/**
- * Depth-Limited Search (DLS) - DFS with depth limit
- * 
- * @param node - current node being visited
- * @param target - goal node to find
- * @param depth - remaining depth limit
- * @param graph - adjacency list representation of graph
- * @param visited - boolean array to track visited nodes
- * @return true if target found, false otherwise
+/*
+ * iddfs(start, target, maxDepth, graph) lives in common/search.h and returns a SearchResult
+ * (found, cost, path, nodes expanded over all iterations). Each depth-limited search runs on the
+ * iterative DFS engine (common/dfs_engine.h) and reuses one SearchWorkspace, cleared in O(1) per
+ * depth limit. This trace policy prints every iteration and expanded node.
  */
-bool dls(int node, int target, int depth, const vector<vector<int>>& graph, vector<bool>& visited) {
-    if (depth < 0) return false;              // Depth limit exceeded
-    
-    if (node == target) {
-        cout << "Found target at node: " << node << endl;
-        return true;                           // Target found
+struct PrintSteps : NoTrace {
+    static void iteration(int limit) { cout << "\nTrying depth limit = " << limit << endl; }
+    static void expand(const SearchStep& step) {
+        cout << "Visited node: " << step.node << " (depth left: " << step.limit - step.g << ")" << endl;
     }
+};
 
-    visited[node] = true;                     // Mark current node as visited
-    cout << "Visited node: " << node << " (depth left: " << depth << ")" << endl;
-
-    // Explore all neighbors within depth limit
-    for (int neighbor : graph[node]) {
-        if (!visited[neighbor]) {
-            if (dls(neighbor, target, depth - 1, graph, visited)) {
-                return true;                   // Target found in subtree
-            }
-        }
-    }
-
-    return false;                             // Target not found in this branch
-}
-
-/**
- * Iterative Deepening DFS Function
- * 
- * @param start - starting node for search
- * @param target - goal node to find
- * @param maxDepth - maximum depth to search
- * @param graph - adjacency list representation of graph
- * @return true if target found, false otherwise
- */
-bool iddfs(int start, int target, int maxDepth, const vector<vector<int>>& graph) {
-    // Try DFS with increasing depth limits
-    for (int depth = 0; depth <= maxDepth; ++depth) {
-        cout << "\nTrying depth limit = " << depth << endl;
-        vector<bool> visited(graph.size(), false);
-        
-        if (dls(start, target, depth, graph, visited)) {
-            return true;                       // Target found at this depth
-        }
+// Report the result of one search
+void report(const SearchResult& result, int maxDepth) {
+    if (result.found) {
+        cout << "Found target at node: " << result.path.back() << endl;
+    } else {
+        cout << "Target not found within depth limit " << maxDepth << endl;
     }
-    return false;                             // Target not found within maxDepth
 }
 
 int main() {
     int n = 6; // Number of nodes
-    vector<vector<int>> graph(n);
+    vector<vector<int>> adjacency(n);
     
     // Create undirected graph using adjacency list
-    graph[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
-    graph[1] = {0, 3, 4}; // Node 1 connects to nodes 0, 3, and 4
-    graph[2] = {0};      // Node 2 connects to node 0
-    graph[3] = {1};      // Node 3 connects to node 1
-    graph[4] = {1, 5};   // Node 4 connects to nodes 1 and 5
-    graph[5] = {4};      // Node 5 connects to node 4
+    adjacency[0] = {1, 2};  // Node 0 connects to nodes 1 and 2
+    adjacency[1] = {0, 3, 4}; // Node 1 connects to nodes 0, 3, and 4
+    adjacency[2] = {0};      // Node 2 connects to node 0
+    adjacency[3] = {1};      // Node 3 connects to node 1
+    adjacency[4] = {1, 5};   // Node 4 connects to nodes 1 and 5
+    adjacency[5] = {4};      // Node 5 connects to node 4
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     int start = 0;
     int goal = 5;
     int maxDepth = 4;
 
     cout << "Iterative Deepening DFS from node " << start << " to " << goal << ":\n";
-    if (!iddfs(start, goal, maxDepth, graph)) {
-        cout << "Target not found within depth limit " << maxDepth << endl;
-    }
+    report(iddfs<PrintSteps>(start, goal, maxDepth, graph), maxDepth);
+
+    // Same search on the compressed (delta + varint) representation
+    CompressedGraph compressed = CompressedGraph::fromCsr(graph);
+    cout << "\nIterative Deepening DFS on the compressed graph:\n";
+    report(iddfs<PrintSteps>(start, goal, maxDepth, compressed), maxDepth);
 
     return 0;
 }
@@ -118,13 +92,14 @@ int main() {
  * - Repeat until target found or max depth reached
  * 
  * Data Structures Used:
- * - Recursion Stack: Implements DFS (LIFO)
- * - Vector<bool>: Tracks visited nodes
- * - Adjacency List: Graph representation
+ * - Explicit Stack: Contiguous (node, next neighbor) frames of the current path (common/dfs_engine.h)
+ * - Search Workspace: Epoch-stamped visited flags, reused across depth limits and calls
+ * - CSR Graph: Contiguous adjacency arrays (common/csr_graph.h)
+ * - Compressed Graph: Delta + varint neighbor lists, decoded while iterating (common/compressed_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(b^d) - may repeat work at shallow levels
- * - Space Complexity: O(d) - recursion stack depth
+ * - Space Complexity: O(d) - explicit stack depth
  * 
  * Advantages:
  * - Guarantees shortest path (like BFS)
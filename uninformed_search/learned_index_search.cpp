@@ -0,0 +1,287 @@
+/*
+ * LEARNED INDEX (PIECEWISE-LINEAR INTERPOLATION) SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Predicts where a key lives in a sorted array with a piecewise-linear model,
+ *              then searches only a small window around the prediction
+ *
+ * Key Characteristics:
+ * - Learns the sorted array's "key -> position" curve as a few straight line segments
+ * - Every segment is fitted with a guaranteed maximum error (maxError positions)
+ * - Lookup = pick the segment, predict the position, bisect a window of 2 * maxError + 1
+ * - Falls back to plain bisection if the prediction window turns out to be wrong
+ * - Same -1 / index semantics as binarySearch()
+ *
+ * Time Complexity: O(log s + log maxError) per lookup, s = number of segments; O(n) to build
+ * Space Complexity: O(s) - the array itself is not copied
+ *
+ * Best for: Sorted keys that grow roughly linearly (timestamps, sequential IDs)
+ * Worst for: Highly skewed / clustered keys (many segments are needed)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <limits>
+#include "../common/array_search.h"
+using namespace std;
+
+// Probe counters filled in by LearnedIndex lookups (optional)
+struct LookupStats {
+    long long probes = 0;       // Elements of the sorted array read
+    long long modelProbes = 0;  // Segment keys read (small, stays in cache)
+    long long fallbacks = 0;    // Lookups that needed full bisection
+};
+
+/**
+ * Learned index over a sorted int array
+ *
+ * The array is NOT copied: it must stay alive (and unchanged) while the index is used.
+ */
+class LearnedIndex {
+public:
+    /**
+     * Fit the piecewise-linear model ("shrinking cone" segmentation)
+     *
+     * @param arr[] - sorted input array
+     * @param size - size of the array
+     * @param maxError - largest allowed distance between predicted and real position
+     */
+    LearnedIndex(const int arr[], int size, int maxError = 16)
+        : data(arr), n(size), eps(maxError) {
+        int i = 0;
+        while (i < n) {
+            // Feasible slopes [lo, hi] keep every point of the segment within +-eps
+            double lo = 0, hi = numeric_limits<double>::infinity();
+            int j = i + 1;
+            for (; j < n; j++) {
+                double dx = (double)arr[j] - arr[i];
+                double dy = j - i;
+                if (dx == 0) {                       // Duplicate of the first key
+                    if (dy > eps) break;
+                    continue;
+                }
+                double newLo = max(lo, (dy - eps) / dx);
+                double newHi = min(hi, (dy + eps) / dx);
+                if (newLo > newHi) break;            // Cone is empty: start a new segment
+                lo = newLo;
+                hi = newHi;
+            }
+            firstKeys.push_back(arr[i]);
+            segments.push_back({i, hi == numeric_limits<double>::infinity() ? 0.0 : (lo + hi) / 2});
+            i = j;
+        }
+    }
+
+    /**
+     * Lower bound: first position whose value is >= target
+     *
+     * @param target - value to search for
+     * @param stats - optional probe counters
+     * @return index in the sorted array, or size if every value is smaller
+     */
+    int lowerBound(int target, LookupStats* stats = nullptr) const {
+        if (n == 0) return 0;
+
+        // 1. Segment: the last one whose first key is < target. The lower bound is inside it
+        //    or is exactly the start of the next segment.
+        int s = lowerBoundIn(firstKeys.data(), 0, firstKeys.size(), target,
+                             stats ? &stats->modelProbes : nullptr) - 1;
+        if (s < 0) return 0;                         // target <= every key
+        int segStart = segments[s].start;
+        int segEnd = (s + 1 < (int)segments.size()) ? segments[s + 1].start : n;
+
+        // 2. Prediction, clamped to the segment
+        double predicted = segStart + segments[s].slope * ((double)target - firstKeys[s]);
+        long long pos = min<long long>(max<long long>((long long)predicted, segStart), segEnd);
+
+        // 3. Bounded local search in [pos - eps - 1, pos + eps + 1]
+        int left = (int)max<long long>(segStart, pos - eps - 1);
+        int right = (int)min<long long>(segEnd, pos + eps + 2);
+        int index = lowerBoundIn(data, left, right, target, stats ? &stats->probes : nullptr);
+
+        // 4. Window check: the answer must not lie outside the window
+        bool tooFarRight = index == left && left > 0 && data[left - 1] >= target;
+        bool tooFarLeft = index == right && right < n && data[right] < target;
+        if (stats && (index == left || index == right)) stats->probes++;
+        if (tooFarRight || tooFarLeft) {
+            if (stats) stats->fallbacks++;
+            index = lowerBoundIn(data, 0, n, target, stats ? &stats->probes : nullptr);
+        }
+        return index;
+    }
+
+    /**
+     * Exact-match search with binarySearch() semantics
+     *
+     * @param target - value to search for
+     * @param stats - optional probe counters
+     * @return index of target if found, -1 if not found
+     *         (the first occurrence when the array has duplicates)
+     */
+    int find(int target, LookupStats* stats = nullptr) const {
+        int index = lowerBound(target, stats);
+        return (index < n && data[index] == target) ? index : -1;
+    }
+
+    int segmentCount() const { return segments.size(); }
+
+    // Model size in bytes (the array itself is not counted)
+    size_t memoryBytes() const {
+        return firstKeys.size() * sizeof(int) + segments.size() * sizeof(Segment);
+    }
+
+private:
+    struct Segment {
+        int start;     // Index of the segment's first key
+        double slope;  // Positions per key unit
+    };
+
+    /**
+     * Lower bound inside arr[left, right), counting the elements read
+     */
+    static int lowerBoundIn(const int arr[], int left, int right, int target, long long* probes) {
+        int len = right - left;
+        const int* base = arr + left;
+        while (len > 0) {
+            int half = len / 2;
+            if (probes) (*probes)++;
+            if (base[half] < target) {
+                base += half + 1;
+                len -= half + 1;
+            } else {
+                len = half;
+            }
+        }
+        return base - arr;
+    }
+
+    const int* data;            // Sorted array (not owned)
+    int n;                      // Number of keys
+    int eps;                    // Maximum prediction error
+    vector<int> firstKeys;      // First key of every segment (searched on its own, cache friendly)
+    vector<Segment> segments;   // Start index and slope of every segment
+};
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile int benchmarkSink;
+
+/**
+ * Build a learned index over keys, verify it and compare it with binarySearch()
+ *
+ * @param label - name of the data set
+ * @param keys - sorted keys
+ * @return number of wrong answers
+ */
+int runDataset(const char* label, vector<int>& keys) {
+    int n = keys.size();
+    auto buildStart = chrono::steady_clock::now();
+    LearnedIndex index(keys.data(), n);
+    double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - buildStart).count();
+
+    const int queries = 1 << 21;
+    mt19937 rng(7);
+    uniform_int_distribution<int> pick(0, n - 1);
+    vector<int> targets(queries);
+    for (int& t : targets) t = keys[pick(rng)] + (int)(rng() % 2);  // Mix of hits and misses
+
+    int mismatches = 0;
+    LookupStats stats;
+    long long binaryProbes = 0;
+    for (int t : targets) {
+        if (index.find(t, &stats) != binarySearch(keys.data(), n, t, &binaryProbes)) mismatches++;
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = binarySearch(keys.data(), n, t);
+    double classic = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = index.find(t);
+    double learned = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "\n" << label << " (" << n << " keys)\n"
+         << "  segments: " << index.segmentCount() << " (" << index.memoryBytes() / 1024.0
+         << " KB model, built in " << buildSeconds << " s)\n"
+         << "  probes/lookup: binarySearch " << (double)binaryProbes / queries
+         << ", learned " << (double)stats.probes / queries
+         << " (+ " << (double)stats.modelProbes / queries << " in the cached model)"
+         << " (fallbacks: " << stats.fallbacks << ")\n"
+         << "  binarySearch: " << classic * 1e9 / queries << " ns/lookup, learned: "
+         << learned * 1e9 / queries << " ns/lookup (" << classic / learned << "x)\n"
+         << "  correctness: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+    return mismatches;
+}
+
+int main() {
+    // Sample data array (MUST be sorted) - same example as binary_search.cpp
+    int data[] = {10, 20, 30, 40, 50, 60};
+    int size = sizeof(data) / sizeof(data[0]);
+
+    LearnedIndex small(data, size);
+    cout << "Sample array uses " << small.segmentCount() << " segment(s)\n";
+    for (int target : {10, 40, 60, 35}) {
+        int result = small.find(target);
+        if (result != -1) {
+            cout << "Found " << target << " at index " << result << endl;
+        } else {
+            cout << "Value " << target << " not found in array" << endl;
+        }
+    }
+
+    const int n = 1 << 24;
+    mt19937 rng(42);
+    int mismatches = 0;
+
+    // Timestamps: regular ticks with random jitter (close to linear)
+    vector<int> timestamps(n);
+    long long t = 0;
+    for (int i = 0; i < n; i++) {
+        t += 50 + rng() % 20;
+        timestamps[i] = (int)t;
+    }
+    mismatches += runDataset("Near-linear timestamps", timestamps);
+
+    // Skewed keys: quadratic growth (model needs more segments)
+    vector<int> skewed(n);
+    for (int i = 0; i < n; i++) skewed[i] = (int)((long long)i * i / n * 100 + i);
+    mismatches += runDataset("Quadratic keys", skewed);
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Building the model (shrinking cone):
+ * - A segment starts at key k0 / position i0 with every slope allowed
+ * - Each following key k / position i only allows slopes in
+ *   [(i - i0 - maxError) / (k - k0), (i - i0 + maxError) / (k - k0)]
+ * - The allowed range shrinks as keys are added; when it becomes empty a new segment starts
+ * - The middle of the final range is stored as the segment slope
+ *
+ * Lookup:
+ * - Binary search over the small firstKeys array to pick the segment (stays in cache)
+ * - predicted = start + slope * (target - firstKey): the real position is within +-maxError
+ * - Bisect only [predicted - maxError - 1, predicted + maxError + 1]
+ * - If the answer sits on a window edge that does not hold, bisect the whole array
+ *   (safety net for floating point rounding; normally never taken)
+ *
+ * Complexity Analysis:
+ * - Build: O(n) time, one pass
+ * - Lookup: O(log s + log maxError) instead of O(log n)
+ * - Space Complexity: O(s) - a few KB for near-linear data
+ *
+ * Comparison with Binary Search:
+ * - binarySearch() ignores the key distribution and always takes ~log2(n) probes
+ * - On near-linear data a handful of segments describe the whole array, so a lookup
+ *   needs only ~log2(2 * maxError) probes into the big array
+ * - On skewed data more segments are needed, but the error bound still holds
+ *
+ * Use Cases:
+ * - Time-series data indexed by timestamp
+ * - Auto-increment IDs with gaps
+ * - Read-mostly sorted columns in databases
+ */
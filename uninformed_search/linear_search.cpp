@@ -18,25 +18,13 @@
  */
 
 #include <iostream>
+#include "../common/array_search.h"
 using namespace std;
 
-/**
- * Linear Search Function
- * 
- * @param arr[] - input array to search in
- * @param size - size of the array
- * @param target - value to search for
- * @return index of target if found, -1 if not found
+/*
+ * linearSearch(arr, size, target) lives in common/array_search.h (shared with the benchmarks):
+ * it compares the elements from left to right and returns the index of the first match, or -1.
  */
-int linearSearch(int arr[], int size, int target) {
-    // Iterate through each element in the array
-    for (int i = 0; i < size; i++) {
-        if (arr[i] == target) {
-            return i; // Found: return the index of target
-        }
-    }
-    return -1; // Not found: return -1
-}
 
 int main() {
     // Sample data array (unsorted)
@@ -0,0 +1,438 @@
+/*
+ * MEMORY-MAPPED SORTED COLUMN (ZERO-COPY BINARY SEARCH)
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: On-disk format for sorted int32/int64 arrays that is searched directly through mmap
+ *
+ * Key Characteristics:
+ * - File = 64-byte header + page-aligned sorted payload + optional prebuilt Eytzinger index
+ * - Loading is just open() + mmap(): no read, no parse, no copy
+ * - Pages are loaded lazily by the OS on first touch, so startup is near-instant
+ * - Read-only shared mapping: several processes share one copy in the page cache
+ * - binarySearch() and the Eytzinger search run directly over the mapped memory
+ *
+ * Time Complexity: O(1) to open, O(log n) per lookup
+ * Space Complexity: O(1) private memory (the data lives in the shared page cache)
+ *
+ * Best for: Large sorted lookup tables reused by many processes / restarts
+ * Worst for: Data that changes often (the file must be rewritten)
+ *
+ * Platform: POSIX (Linux, macOS); files use the machine's native (little-endian) byte order
+ */
+
+#include <iostream>
+#include <fstream>
+#include <cstddef>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+const char SORTED_COLUMN_MAGIC[8] = {'S', 'O', 'R', 'T', 'C', 'O', 'L', '1'};
+const uint32_t SORTED_COLUMN_VERSION = 1;
+const uint64_t PAYLOAD_ALIGNMENT = 4096;  // Payload starts on a page boundary
+const uint64_t INDEX_ALIGNMENT = 64;      // Index sections start on a cache line
+
+/**
+ * File header (64 bytes, at offset 0)
+ */
+struct SortedColumnHeader {
+    char magic[8];          // "SORTCOL1"
+    uint32_t version;       // SORTED_COLUMN_VERSION
+    uint32_t valueBytes;    // 4 = int32 payload, 8 = int64 payload
+    uint64_t count;         // Number of sorted values
+    uint64_t dataOffset;    // Byte offset of the sorted payload
+    uint64_t indexOffset;   // Byte offset of the Eytzinger keys (count + 1 values), 0 = no index
+    uint64_t rankOffset;    // Byte offset of the Eytzinger -> sorted position map (int64)
+    uint64_t fileBytes;     // Total file size, used to detect truncated files
+    uint64_t reserved;      // Zero
+};
+static_assert(sizeof(SortedColumnHeader) == 64, "header must stay 64 bytes");
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * Binary Search Function (binary_search.cpp, generalised to int32/int64 and const memory)
+ *
+ * @param arr[] - sorted input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @return index of target if found, -1 if not found
+ */
+template <typename T>
+long long binarySearch(const T arr[], long long size, T target) {
+    long long left = 0;
+    long long right = size - 1;
+
+    while (left <= right) {
+        long long mid = left + (right - left) / 2;
+
+        if (arr[mid] == target) {
+            return mid;
+        } else if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Eytzinger search (same algorithm as eytzinger_binary_search.cpp) over mapped arrays
+ *
+ * @param keys - values in Eytzinger order, 1-indexed, 64-byte aligned
+ * @param rank - Eytzinger position -> index in the sorted payload
+ * @param n - number of values
+ * @param target - value to search for
+ * @return index of target in the sorted payload if found, -1 if not found
+ */
+template <typename T>
+long long eytzingerSearch(const T keys[], const int64_t rank[], long long n, T target) {
+    const long long perLine = 64 / sizeof(T);  // Descendants 4 (int32) or 3 (int64) levels down
+    long long k = 1;
+    while (k <= n) {
+        __builtin_prefetch(keys + k * perLine);
+        k = 2 * k + (keys[k] < target);
+    }
+    k >>= __builtin_ffsll(~k);
+    return (k != 0 && keys[k] == target) ? rank[k] : -1;
+}
+
+/**
+ * Write a sorted array as a sorted-column file
+ *
+ * @param path - output file
+ * @param sorted - sorted values
+ * @param count - number of values
+ * @param withIndex - also store a prebuilt Eytzinger index
+ * @return true on success
+ */
+template <typename T>
+bool writeSortedColumn(const char* path, const T sorted[], long long count, bool withIndex) {
+    static_assert(is_same<T, int32_t>::value || is_same<T, int64_t>::value, "int32 or int64 only");
+
+    for (long long i = 1; i < count; i++) {
+        if (sorted[i - 1] > sorted[i]) {
+            cerr << "writeSortedColumn: input is not sorted at index " << i << endl;
+            return false;
+        }
+    }
+
+    SortedColumnHeader header = {};
+    memcpy(header.magic, SORTED_COLUMN_MAGIC, sizeof(header.magic));
+    header.version = SORTED_COLUMN_VERSION;
+    header.valueBytes = sizeof(T);
+    header.count = count;
+    header.dataOffset = PAYLOAD_ALIGNMENT;
+    uint64_t end = header.dataOffset + count * sizeof(T);
+
+    // Eytzinger layout: in-order walk of the implicit tree (iterative, explicit stack)
+    vector<T> keys;
+    vector<int64_t> rank;
+    if (withIndex) {
+        keys.assign(count + 1, 0);
+        rank.assign(count + 1, -1);
+        vector<long long> stack;
+        long long next = 0, k = 1;
+        while (k <= count || !stack.empty()) {
+            if (k <= count) {
+                stack.push_back(k);
+                k = 2 * k;                // Go left first: smaller values
+            } else {
+                k = stack.back();
+                stack.pop_back();
+                keys[k] = sorted[next];
+                rank[k] = next++;
+                k = 2 * k + 1;            // Then the right subtree
+            }
+        }
+        header.indexOffset = alignUp(end, INDEX_ALIGNMENT);
+        header.rankOffset = alignUp(header.indexOffset + (count + 1) * sizeof(T), INDEX_ALIGNMENT);
+        end = header.rankOffset + (count + 1) * sizeof(int64_t);
+    }
+    header.fileBytes = end;
+
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) {
+        cerr << "writeSortedColumn: cannot create " << path << endl;
+        return false;
+    }
+    auto writeAt = [&](uint64_t offset, const void* bytes, uint64_t length) {
+        out.seekp(offset);
+        out.write(static_cast<const char*>(bytes), length);
+    };
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.dataOffset, sorted, count * sizeof(T));
+    if (withIndex) {
+        writeAt(header.indexOffset, keys.data(), keys.size() * sizeof(T));
+        writeAt(header.rankOffset, rank.data(), rank.size() * sizeof(int64_t));
+    }
+    out.close();
+    if (!out) {
+        cerr << "writeSortedColumn: write to " << path << " failed" << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Read-only, zero-copy view of a sorted-column file
+ */
+template <typename T>
+class MappedSortedColumn {
+public:
+    MappedSortedColumn() = default;
+    ~MappedSortedColumn() { close(); }
+
+    MappedSortedColumn(const MappedSortedColumn&) = delete;
+    MappedSortedColumn& operator=(const MappedSortedColumn&) = delete;
+
+    /**
+     * Map a sorted-column file and validate its header
+     *
+     * @param path - file written by writeSortedColumn()
+     * @return true on success (errors are printed to cerr)
+     */
+    bool open(const char* path) {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            cerr << "MappedSortedColumn: cannot open " << path << endl;
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || (uint64_t)info.st_size < sizeof(SortedColumnHeader)) {
+            cerr << "MappedSortedColumn: " << path << " is too small" << endl;
+            ::close(fd);
+            return false;
+        }
+
+        mappedBytes = info.st_size;
+        void* base = mmap(nullptr, mappedBytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // The mapping stays valid after the descriptor is closed
+        if (base == MAP_FAILED) {
+            cerr << "MappedSortedColumn: mmap of " << path << " failed" << endl;
+            return false;
+        }
+        mapping = static_cast<const char*>(base);
+
+        const SortedColumnHeader* h = reinterpret_cast<const SortedColumnHeader*>(mapping);
+        const char* problem = nullptr;
+        if (memcmp(h->magic, SORTED_COLUMN_MAGIC, sizeof(h->magic)) != 0) problem = "bad magic";
+        else if (h->version != SORTED_COLUMN_VERSION) problem = "unsupported version";
+        else if (h->valueBytes != sizeof(T)) problem = "value width does not match";
+        else if (h->fileBytes != mappedBytes) problem = "file size does not match header (truncated?)";
+        else if (h->count > mappedBytes / sizeof(T)) problem = "count larger than the file";
+        else if (h->dataOffset % PAYLOAD_ALIGNMENT != 0) problem = "payload misaligned";
+        else if (!sectionFits(h->dataOffset, h->count, sizeof(T))) problem = "payload out of range";
+        else if (h->indexOffset != 0 &&
+                 (h->indexOffset % INDEX_ALIGNMENT != 0 || h->rankOffset % INDEX_ALIGNMENT != 0)) problem = "index misaligned";
+        else if (h->indexOffset != 0 &&
+                 (!sectionFits(h->indexOffset, h->count + 1, sizeof(T)) ||
+                  !sectionFits(h->rankOffset, h->count + 1, sizeof(int64_t)))) problem = "index out of range";
+        if (problem) {
+            cerr << "MappedSortedColumn: " << path << ": " << problem << endl;
+            close();
+            return false;
+        }
+
+        count = h->count;
+        data = reinterpret_cast<const T*>(mapping + h->dataOffset);
+        if (h->indexOffset != 0) {
+            keys = reinterpret_cast<const T*>(mapping + h->indexOffset);
+            rank = reinterpret_cast<const int64_t*>(mapping + h->rankOffset);
+        }
+        // Lookups jump around: do not let the kernel read ahead whole megabytes
+        madvise(const_cast<char*>(mapping), mappedBytes, MADV_RANDOM);
+        return true;
+    }
+
+    void close() {
+        if (mapping) munmap(const_cast<char*>(mapping), mappedBytes);
+        mapping = nullptr;
+        data = keys = nullptr;
+        rank = nullptr;
+        count = 0;
+    }
+
+    long long size() const { return count; }
+    const T* values() const { return data; }   // Sorted payload, usable by any array search
+    bool hasIndex() const { return keys != nullptr; }
+
+    /**
+     * Plain binarySearch() over the mapped payload
+     *
+     * @param target - value to search for
+     * @return index of target if found, -1 if not found
+     */
+    long long binaryFind(T target) const { return binarySearch(data, count, target); }
+
+    /**
+     * Fastest available search: Eytzinger index if the file has one, else binarySearch()
+     *
+     * @param target - value to search for
+     * @return index of target if found, -1 if not found
+     */
+    long long find(T target) const {
+        return keys ? eytzingerSearch(keys, rank, count, target) : binarySearch(data, count, target);
+    }
+
+private:
+    // True if elements * elementBytes bytes from offset lie after the header and inside the
+    // mapping; written as divisions so crafted header values cannot overflow the check
+    bool sectionFits(uint64_t offset, uint64_t elements, uint64_t elementBytes) const {
+        if (offset < sizeof(SortedColumnHeader) || offset > mappedBytes) return false;
+        return elements <= (mappedBytes - offset) / elementBytes;
+    }
+
+    const char* mapping = nullptr;
+    size_t mappedBytes = 0;
+    long long count = 0;
+    const T* data = nullptr;       // Sorted payload
+    const T* keys = nullptr;       // Eytzinger keys (optional)
+    const int64_t* rank = nullptr; // Eytzinger -> payload index (optional)
+};
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile long long benchmarkSink;
+
+/**
+ * Overwrite one header field of a sorted-column file (crafted / corrupted file test)
+ */
+void patchHeader(const char* path, size_t fieldOffset, uint64_t value) {
+    fstream file(path, ios::in | ios::out | ios::binary);
+    file.seekp(fieldOffset);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+int main(int argc, char* argv[]) {
+    const char* path = argc > 1 ? argv[1] : "sorted_column.bin";
+
+    // Sample data array (MUST be sorted) - same example as binary_search.cpp
+    int32_t data[] = {10, 20, 30, 40, 50, 60};
+    writeSortedColumn(path, data, 6, true);
+    {
+        MappedSortedColumn<int32_t> column;
+        if (!column.open(path)) return 1;
+        for (int32_t target : {10, 40, 35}) {
+            cout << "find(" << target << ") = " << column.find(target)
+                 << ", binaryFind(" << target << ") = " << column.binaryFind(target) << endl;
+        }
+    }
+
+    // Crafted headers must be rejected before any section is touched
+    struct { size_t field; uint64_t value; } crafted[] = {
+        {offsetof(SortedColumnHeader, count), UINT64_MAX / 2},             // count * 4 overflows
+        {offsetof(SortedColumnHeader, dataOffset), PAYLOAD_ALIGNMENT + 2},  // misaligned payload
+        {offsetof(SortedColumnHeader, dataOffset), UINT64_MAX - 4095},      // offset + size overflows
+        {offsetof(SortedColumnHeader, rankOffset), UINT64_MAX - 63},        // rank map out of range
+        {offsetof(SortedColumnHeader, indexOffset), 1 << 20},               // keys out of range
+    };
+    int accepted = 0;
+    for (const auto& c : crafted) {
+        writeSortedColumn(path, data, 6, true);
+        patchHeader(path, c.field, c.value);
+        MappedSortedColumn<int32_t> column;
+        if (column.open(path)) accepted++;
+    }
+    cout << "Crafted headers rejected: " << (accepted == 0 ? "OK" : "MISMATCH") << endl;
+
+    // Large int64 column, e.g. sorted IDs
+    const long long n = 1 << 24;
+    vector<int64_t> ids(n);
+    for (long long i = 0; i < n; i++) ids[i] = 5 * i + 3;
+
+    auto start = chrono::steady_clock::now();
+    if (!writeSortedColumn(path, ids.data(), n, true)) return 1;
+    double writeSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "\nWrote " << n << " int64 values + index in " << writeSeconds << " s" << endl;
+
+    // Startup cost: read the payload into memory vs map the file
+    start = chrono::steady_clock::now();
+    {
+        ifstream in(path, ios::binary);
+        vector<int64_t> loaded(n);
+        in.seekg(PAYLOAD_ALIGNMENT);
+        in.read(reinterpret_cast<char*>(loaded.data()), n * sizeof(int64_t));
+        benchmarkSink = loaded[n / 2];
+    }
+    double readSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    MappedSortedColumn<int64_t> column;
+    if (!column.open(path)) return 1;
+    double mapSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Load by read(): " << readSeconds * 1000 << " ms, by mmap: " << mapSeconds * 1000 << " ms\n";
+
+    // Lookups straight from the mapping
+    const int queries = 1 << 21;
+    mt19937_64 rng(42);
+    vector<int64_t> targets(queries);
+    for (int64_t& t : targets) t = rng() % (5 * n);
+
+    int mismatches = 0;
+    for (int i = 0; i < 100000; i++) {
+        long long expected = binarySearch(ids.data(), n, targets[i]);
+        if (column.find(targets[i]) != expected || column.binaryFind(targets[i]) != expected) mismatches++;
+    }
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    start = chrono::steady_clock::now();
+    for (int64_t t : targets) benchmarkSink = column.binaryFind(t);
+    double binarySeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (int64_t t : targets) benchmarkSink = column.find(t);
+    double indexSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Mapped binarySearch: " << binarySeconds * 1e9 / queries << " ns/lookup\n"
+         << "Mapped Eytzinger:    " << indexSeconds * 1e9 / queries << " ns/lookup\n";
+
+    column.close();
+    remove(path);
+    return mismatches == 0 && accepted == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * File Layout:
+ * | Offset            | Content                                             |
+ * |-------------------|-----------------------------------------------------|
+ * | 0                 | SortedColumnHeader (64 bytes)                       |
+ * | dataOffset (4096) | count sorted values (int32 or int64)                |
+ * | indexOffset       | count + 1 values in Eytzinger order (optional)      |
+ * | rankOffset        | count + 1 int64: Eytzinger position -> sorted index |
+ *
+ * Code Breakdown:
+ * - mmap(PROT_READ, MAP_SHARED) - map the file; nothing is read until a page is touched
+ * - Header checks - magic, version, value width and file size reject wrong or truncated files
+ * - madvise(MADV_RANDOM) - searches touch scattered pages, so read-ahead would waste I/O
+ * - binaryFind() / find() - the same search code as for in-memory arrays, on mapped pointers
+ *
+ * Complexity Analysis:
+ * - Open: O(1) - independent of the file size
+ * - Lookup: O(log n); the first lookups may page-fault, later ones hit the page cache
+ * - Space Complexity: O(1) private memory; the page cache is shared between processes
+ *
+ * Advantages:
+ * - No parsing or copying at startup
+ * - Many processes mapping the same file share one copy in RAM
+ * - The prebuilt index is built once at write time, not at every start
+ *
+ * Use Cases:
+ * - Static lookup tables shipped as files
+ * - Services that restart often but search the same sorted data
+ */
@@ -0,0 +1,228 @@
+/*
+ * MULTI-SOURCE BIT-PARALLEL BREADTH-FIRST SEARCH (MS-BFS)
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Runs up to 64 x WORDS BFS traversals at once, one bit per traversal
+ *
+ * Key Characteristics:
+ * - Every vertex holds bitmasks instead of booleans: bit i of seen[v] = "traversal i has reached v"
+ * - One scan of v's neighbor list advances every traversal whose frontier contains v:
+ *     newBits = visit[v] & ~seen[neighbor]
+ * - Traversals that overlap (same graph region, same level) share their adjacency scans
+ * - Masks are 64-bit words (64 sources) or arrays of words (256 sources with WORDS = 4);
+ *   the word loops are plain bitwise operations the compiler turns into SIMD instructions
+ * - Larger source lists are processed in batches
+ * - Same hop distances as bfs() of common/search.h, for every source
+ *
+ * Algorithm: Then et al., "The More the Merrier: Efficient Multi-Source Graph Traversal" (VLDB 2014)
+ *
+ * Time Complexity: O(D * (V + E) * WORDS) per batch, D = deepest level; in practice far less than
+ *                  one BFS per source because levels of different sources are scanned together
+ * Space Complexity: O(V * WORDS) words for the masks, plus the S x V distance output
+ *
+ * Best for: Thousands of BFS traversals on the same graph (reachability, closeness, hop histograms)
+ * Worst for: A single traversal (use bfs), sources far apart on a high-diameter graph
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <climits>
+#include <cstdlib>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+#include "../common/search.h"
+using namespace std;
+
+/**
+ * Fixed-size bitset of WORDS 64-bit words (one bit per concurrent traversal)
+ */
+template <int WORDS>
+struct SourceMask {
+    uint64_t word[WORDS];
+
+    bool any() const {
+        uint64_t all = 0;
+        for (int i = 0; i < WORDS; i++) all |= word[i];
+        return all != 0;
+    }
+};
+
+/**
+ * Multi-Source BFS Function (one batch of at most 64 * WORDS sources)
+ *
+ * @param graph - graph in CSR form (see common/csr_graph.h)
+ * @param sources - start vertices; traversal i starts at sources[i]
+ * @param dist - receives hop distances, dist[i * V + v] = distance from sources[i] to v (-1 = unreachable)
+ */
+template <int WORDS>
+void msBfsBatch(const CsrGraph& graph, const vector<int>& sources, int* dist) {
+    using Mask = SourceMask<WORDS>;
+    int n = graph.numVertices();
+    int k = sources.size();
+    vector<Mask> seen(n, Mask{}), visit(n, Mask{}), visitNext(n, Mask{});
+
+    for (int i = 0; i < k; i++) {
+        int s = sources[i];
+        seen[s].word[i >> 6] |= uint64_t(1) << (i & 63);
+        visit[s].word[i >> 6] |= uint64_t(1) << (i & 63);
+        dist[(size_t)i * n + s] = 0;
+    }
+
+    for (int level = 1;; level++) {
+        // Top-down step for all traversals at once
+        bool active = false;
+        for (int v = 0; v < n; v++) {
+            if (!visit[v].any()) continue;
+            const Mask frontier = visit[v];
+            for (int neighbor : graph.neighbors(v)) {
+                Mask fresh;
+                uint64_t any = 0;
+                for (int w = 0; w < WORDS; w++) {
+                    fresh.word[w] = frontier.word[w] & ~seen[neighbor].word[w];
+                    any |= fresh.word[w];
+                }
+                if (!any) continue;  // Every traversal here has reached neighbor already: no write
+                for (int w = 0; w < WORDS; w++) {
+                    visitNext[neighbor].word[w] |= fresh.word[w];
+                    seen[neighbor].word[w] |= fresh.word[w];
+                }
+            }
+        }
+
+        // Record the distances of the new level and make it the frontier
+        for (int v = 0; v < n; v++) {
+            for (int w = 0; w < WORDS; w++) {
+                uint64_t bits = visitNext[v].word[w];
+                visit[v].word[w] = bits;
+                visitNext[v].word[w] = 0;
+                if (bits) active = true;
+                while (bits) {
+                    int i = w * 64 + __builtin_ctzll(bits);
+                    dist[(size_t)i * n + v] = level;
+                    bits &= bits - 1;
+                }
+            }
+        }
+        if (!active) break;
+    }
+}
+
+/**
+ * Hop distances from many sources, in batches of 64 * WORDS traversals
+ *
+ * @param graph - graph in CSR form (see common/csr_graph.h)
+ * @param sources - start vertices (any number)
+ * @return dist[i * V + v] = hop distance from sources[i] to v, -1 if unreachable
+ */
+template <int WORDS = 1>
+vector<int> multiSourceBfs(const CsrGraph& graph, const vector<int>& sources) {
+    const int batchSize = 64 * WORDS;
+    int n = graph.numVertices();
+    vector<int> dist((size_t)sources.size() * n, -1);
+    for (size_t first = 0; first < sources.size(); first += batchSize) {
+        size_t last = min(sources.size(), first + batchSize);
+        vector<int> batch(sources.begin() + first, sources.begin() + last);
+        msBfsBatch<WORDS>(graph, batch, dist.data() + first * n);
+    }
+    return dist;
+}
+
+/**
+ * Hop distances of one bfs() of common/search.h (the reference), read from its workspace
+ */
+void bfsDistances(int start, const CsrGraph& graph, int* dist) {
+    SearchWorkspace& workspace = SearchWorkspace::forThread();
+    bfs(start, graph, -1, workspace);
+    for (int v = 0; v < graph.numVertices(); v++) dist[v] = workspace.cost(v) == INT_MAX ? -1 : workspace.cost(v);
+}
+
+int main(int argc, char* argv[]) {
+    int n = 6; // Number of nodes in graph
+    vector<vector<int>> adjacency(n);
+
+    // Same undirected graph as breadth_first_search.cpp
+    adjacency[0] = {1, 2};
+    adjacency[1] = {0, 3, 4};
+    adjacency[2] = {0};
+    adjacency[3] = {1};
+    adjacency[4] = {1, 5};
+    adjacency[5] = {4};
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);
+
+    vector<int> sources = {0, 3, 5};
+    vector<int> dist = multiSourceBfs(graph, sources);
+    cout << "Hop distances from several sources at once:\n";
+    for (size_t i = 0; i < sources.size(); i++) {
+        cout << "From node " << sources[i] << ":";
+        for (int v = 0; v < n; v++) cout << " " << dist[i * n + v];
+        cout << endl;
+    }
+
+    // Batch benchmark: many sources on a power-law graph (common/graph_generators.h)
+    int scale = argc > 1 ? atoi(argv[1]) : 16;
+    int count = argc > 2 ? atoi(argv[2]) : 512;
+    GeneratedGraph rmat = generateRmat(scale, 8, 1, 42);
+    const CsrGraph& g = rmat.graph;
+    int vertices = g.numVertices();
+    cout << "\nR-MAT graph: " << vertices << " vertices, " << g.numEdges() << " edges, "
+         << count << " sources\n";
+
+    // Sources: vertices spread over the id range that have at least one edge
+    vector<int> starts;
+    for (int v = 0; (int)starts.size() < count && v < vertices; v += 1 + (v * 7919) % 13) {
+        if (g.degree(v) > 0) starts.push_back(v);
+    }
+
+    auto begin = chrono::steady_clock::now();
+    vector<int> expected((size_t)starts.size() * vertices, -1);
+    for (size_t i = 0; i < starts.size(); i++) bfsDistances(starts[i], g, expected.data() + i * vertices);
+    double serial = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    begin = chrono::steady_clock::now();
+    vector<int> batched64 = multiSourceBfs<1>(g, starts);
+    double ms64 = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    begin = chrono::steady_clock::now();
+    vector<int> batched256 = multiSourceBfs<4>(g, starts);
+    double ms256 = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    bool same = batched64 == expected && batched256 == expected;
+    cout << "Correctness check: " << (same ? "OK" : "MISMATCH") << endl;
+    cout << "  " << starts.size() << " x bfs:          " << serial * 1000 << " ms\n";
+    cout << "  MS-BFS, 64 per batch:  " << ms64 * 1000 << " ms (" << serial / ms64 << "x)\n";
+    cout << "  MS-BFS, 256 per batch: " << ms256 * 1000 << " ms (" << serial / ms256 << "x)\n";
+
+    return same ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Key Features:
+ * - One adjacency scan per vertex and level serves every traversal that has v in its frontier
+ * - Bitwise AND / OR / NOT replace per-traversal visited checks
+ * - Exact BFS hop distances for every source
+ *
+ * Data Structures Used:
+ * - seen[v]: Traversals that have reached v (replaces one visited vector per traversal)
+ * - visit[v] / visitNext[v]: Traversals with v in the current / next frontier
+ * - Flat distance matrix: dist[source index * V + v]
+ * - CSR Graph: Contiguous adjacency arrays (common/csr_graph.h)
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O(D * V * WORDS + sum over levels of frontier edges) per batch
+ * - Space Complexity: O(V * WORDS) words of masks (3 masks per vertex) + the S x V output
+ *
+ * Performance Notes:
+ * - Gains grow with overlap: on small-world graphs all traversals reach the big middle levels
+ *   together, so a batch costs little more than a single BFS
+ * - Every level scans all V masks; on high-diameter graphs (grids, roads) with few active
+ *   vertices per level, plain bfs can be faster
+ * - WORDS = 4 halves the number of batches again; each mask is one 256-bit register
+ *
+ * Use Cases:
+ * - Closeness centrality, hop-distance histograms, reachability for many sources
+ * - All-pairs hop distances on small graphs
+ */
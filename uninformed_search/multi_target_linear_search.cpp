@@ -0,0 +1,314 @@
+/*
+ * MULTI-TARGET LINEAR SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Finds the first index of MANY target values in one pass over an unsorted array
+ *
+ * Key Characteristics:
+ * - One scan answers every target, instead of one full scan per target
+ * - Small target sets: every element block is compared with all targets using SIMD
+ *   broadcast compares (AVX2, picked at startup; scalar fallback)
+ * - Large target sets: a small bitmap rejects most elements, a hash table resolves the rest
+ * - Stops as soon as every target has been found
+ * - Per target, same answer as linearSearch(): index of the first match, or -1
+ *
+ * Time Complexity: O(n + k) for k targets (instead of O(n * k))
+ * Space Complexity: O(k) - hash table and bitmap
+ *
+ * Best for: Looking up many values in the same large unsorted array
+ * Worst for: A single target (use Linear Search / SIMD Linear Search)
+ */
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MULTI_TARGET_SEARCH_X86 1
+#endif
+#include "../common/array_search.h"
+using namespace std;
+
+// Up to this many distinct targets use broadcast compares; more use the hash table
+const int SMALL_TARGET_SET = 8;
+
+// Largest prefilter bitmap: 2^20 bits = 128 KB (fits in L2). Target sets that would need a larger
+// one (more than ~64K distinct targets) skip the prefilter and probe the hash table directly
+const int MAX_BITMAP_BITS = 20;
+
+/**
+ * Distinct targets of one query and their answers (duplicates share an answer)
+ */
+struct TargetSet {
+    vector<int> values;      // Distinct target values
+    vector<int> firstIndex;  // Answer for values[u], -1 while not found
+    vector<int> slotOf;      // For every input target: position in values
+
+    TargetSet(const int targets[], int count) : slotOf(count) {
+        vector<pair<int, int>> sorted(count);
+        for (int i = 0; i < count; i++) sorted[i] = {targets[i], i};
+        sort(sorted.begin(), sorted.end());
+        for (int i = 0; i < count; i++) {
+            if (i == 0 || sorted[i].first != sorted[i - 1].first) {
+                values.push_back(sorted[i].first);
+            }
+            slotOf[sorted[i].second] = values.size() - 1;
+        }
+        firstIndex.assign(values.size(), -1);
+    }
+};
+
+/**
+ * Scalar scan for small target sets: compare each element with the unresolved targets
+ *
+ * @param arr[] - input array
+ * @param begin - first index to scan
+ * @param size - size of the array
+ * @param set - targets; answers are filled in
+ */
+void scanSmallScalar(const int arr[], int begin, int size, TargetSet& set) {
+    int remaining = 0;
+    for (int answer : set.firstIndex) remaining += answer == -1;
+
+    for (int i = begin; i < size && remaining > 0; i++) {
+        for (size_t u = 0; u < set.values.size(); u++) {
+            if (arr[i] == set.values[u] && set.firstIndex[u] == -1) {
+                set.firstIndex[u] = i;
+                remaining--;
+            }
+        }
+    }
+}
+
+#ifdef MULTI_TARGET_SEARCH_X86
+/**
+ * AVX2 scan for small target sets: 8 elements x all targets per step
+ *
+ * @param arr[] - input array
+ * @param size - size of the array
+ * @param set - targets; answers are filled in
+ */
+__attribute__((target("avx2")))
+void scanSmallAvx2(const int arr[], int size, TargetSet& set) {
+    // Unresolved targets, each broadcast into all 8 lanes
+    int active = set.values.size();
+    int activeSlot[SMALL_TARGET_SET];
+    __m256i needles[SMALL_TARGET_SET];
+    for (int u = 0; u < active; u++) {
+        activeSlot[u] = u;
+        needles[u] = _mm256_set1_epi32(set.values[u]);
+    }
+
+    int i = 0;
+    for (; i + 8 <= size && active > 0; i += 8) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(arr + i));
+        __m256i any = _mm256_setzero_si256();
+        for (int a = 0; a < active; a++) {
+            any = _mm256_or_si256(any, _mm256_cmpeq_epi32(block, needles[a]));
+        }
+        if (_mm256_testz_si256(any, any)) continue;  // Common case: no target in this block
+
+        // Rare: resolve which targets matched, then drop them from the active set
+        for (int a = 0; a < active; a++) {
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needles[a])));
+            if (mask) {
+                set.firstIndex[activeSlot[a]] = i + __builtin_ctz(mask);
+                activeSlot[a] = activeSlot[active - 1];
+                needles[a] = needles[active - 1];
+                active--;
+                a--;
+            }
+        }
+    }
+
+    if (active > 0) scanSmallScalar(arr, i, size, set);  // Last size % 8 elements
+}
+#endif
+
+// Signature shared by the small-set kernels
+using SmallScanKernel = void (*)(const int[], int, TargetSet&);
+
+void scanSmallScalarFromStart(const int arr[], int size, TargetSet& set) {
+    scanSmallScalar(arr, 0, size, set);
+}
+
+/**
+ * Pick the small-set kernel once, from the running CPU's features
+ */
+SmallScanKernel selectSmallScanKernel() {
+#ifdef MULTI_TARGET_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return scanSmallAvx2;
+#endif
+    return scanSmallScalarFromStart;
+}
+
+const SmallScanKernel smallScanKernel = selectSmallScanKernel();
+
+/**
+ * Large target sets: bitmap prefilter + open-addressing hash table
+ *
+ * @param arr[] - input array
+ * @param size - size of the array
+ * @param set - targets; answers are filled in
+ */
+void scanLarge(const int arr[], int size, TargetSet& set) {
+    int distinct = set.values.size();
+
+    // Hash table with at least 2x free space (power of two, linear probing; at most 2^31 slots)
+    int tableBits = 1;
+    while ((1ll << tableBits) < 2ll * distinct) tableBits++;
+    vector<int> table((size_t)1 << tableBits, -1);  // Slot in set.values, -1 = empty
+    const uint32_t tableMask = (uint32_t)(((uint64_t)1 << tableBits) - 1);
+
+    // Bitmap with ~16 bits per target: one bit test rejects most non-target elements.
+    // Capped at MAX_BITMAP_BITS: beyond 128 KB it would no longer stay in L2, so huge target
+    // sets use the hash table alone
+    int bitmapBits = max(12, tableBits + 3);
+    bool prefilter = bitmapBits <= MAX_BITMAP_BITS;
+    if (!prefilter) bitmapBits = 0;
+    vector<uint64_t> bitmap(prefilter ? ((size_t)1 << bitmapBits) / 64 : 0, 0);
+
+    auto hash = [](int x) { return (uint32_t)x * 0x9E3779B1u; };  // Fibonacci hashing
+    for (int u = 0; u < distinct; u++) {
+        uint32_t h = hash(set.values[u]);
+        if (prefilter) {
+            uint32_t bit = h >> (32 - bitmapBits);
+            bitmap[bit / 64] |= 1ull << (bit % 64);
+        }
+        uint32_t pos = (h >> (32 - tableBits)) & tableMask;
+        while (table[pos] != -1) pos = (pos + 1) & tableMask;
+        table[pos] = u;
+    }
+
+    int remaining = distinct;
+    for (int i = 0; i < size && remaining > 0; i++) {
+        uint32_t h = hash(arr[i]);
+        if (prefilter) {
+            uint32_t bit = h >> (32 - bitmapBits);
+            if (!(bitmap[bit / 64] >> (bit % 64) & 1)) continue;  // Definitely not a target
+        }
+
+        for (uint32_t pos = (h >> (32 - tableBits)) & tableMask; table[pos] != -1; pos = (pos + 1) & tableMask) {
+            int u = table[pos];
+            if (set.values[u] == arr[i]) {
+                if (set.firstIndex[u] == -1) {
+                    set.firstIndex[u] = i;
+                    remaining--;
+                }
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Multi-Target Linear Search Function
+ *
+ * @param arr[] - input array to search in
+ * @param size - size of the array
+ * @param targets[] - values to search for (duplicates allowed)
+ * @param count - number of targets
+ * @param results[] - receives, for each target, the index of its first occurrence or -1
+ */
+void multiLinearSearch(const int arr[], int size, const int targets[], int count, int results[]) {
+    TargetSet set(targets, count);
+
+    if ((int)set.values.size() <= SMALL_TARGET_SET) {
+        smallScanKernel(arr, size, set);
+    } else {
+        scanLarge(arr, size, set);
+    }
+
+    for (int i = 0; i < count; i++) results[i] = set.firstIndex[set.slotOf[i]];
+}
+
+int main() {
+    // Sample data array (unsorted) - same example as linear_search.cpp
+    int data[] = {10, 25, 30, 45, 50};
+    int size = sizeof(data) / sizeof(data[0]);
+
+    int queries[] = {45, 99, 10, 45};
+    int answers[4];
+    multiLinearSearch(data, size, queries, 4, answers);
+    for (int i = 0; i < 4; i++) {
+        cout << "Target " << queries[i] << ": index " << answers[i] << endl;
+    }
+
+    // Large unsorted column
+    const int n = 1 << 22; // 4M ints = 16 MB
+    vector<int> column(n);
+    mt19937 rng(42);
+    for (int& x : column) x = rng() % 50000000;
+
+    int mismatches = 0;
+    cout << "\nOne pass vs one linearSearch() per target over " << n << " ints:\n";
+    for (int k : {4, 64, 1024}) {
+        vector<int> targets(k), onePass(k), perTarget(k);
+        for (int t = 0; t < k; t++) {
+            // Half of the targets occur in the array, half never do
+            targets[t] = (t % 2 == 0) ? column[rng() % n] : 50000000 + t;
+        }
+
+        auto start = chrono::steady_clock::now();
+        multiLinearSearch(column.data(), n, targets.data(), k, onePass.data());
+        double single = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        for (int t = 0; t < k; t++) perTarget[t] = linearSearch(column.data(), n, targets[t]);
+        double repeated = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        if (onePass != perTarget) mismatches++;
+        cout << "  k = " << k << ": one pass " << single * 1000 << " ms, per target "
+             << repeated * 1000 << " ms (" << repeated / single << "x)\n";
+    }
+
+    // Huge target set (no prefilter): check against the first index of every value
+    const int huge = 1 << 18;
+    vector<int> targets(huge), onePass(huge);
+    for (int t = 0; t < huge; t++) targets[t] = (t % 2 == 0) ? column[rng() % n] : 50000000 + t;
+    unordered_map<int, int> first;
+    for (int i = n - 1; i >= 0; i--) first[column[i]] = i;
+    auto start = chrono::steady_clock::now();
+    multiLinearSearch(column.data(), n, targets.data(), huge, onePass.data());
+    double single = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (int t = 0; t < huge; t++) {
+        auto it = first.find(targets[t]);
+        if (onePass[t] != (it == first.end() ? -1 : it->second)) mismatches++;
+    }
+    cout << "  k = " << huge << " (hash table only): one pass " << single * 1000 << " ms\n";
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Code Breakdown:
+ * - TargetSet - removes duplicate targets; duplicates share one answer
+ * - Small sets (<= 8 distinct): each block of 8 elements is compared with every target
+ *   broadcast into a SIMD register; one branch per block, found targets are dropped
+ * - Large sets: hash(x) picks one bit of a bitmap of 512 B to 128 KB (32 KB of L1 holds it up
+ *   to ~16K targets, the 2^20-bit cap needs L2); only elements whose bit is set look into the
+ *   hash table, so most elements cost one bit test. Sets too large for such a bitmap
+ *   (> ~64K distinct targets) use the hash table alone
+ * - remaining - the scan ends early once every target has an answer
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O(n + k log k) - one scan plus sorting the targets
+ * - Repeated linearSearch(): O(n * k) - the array is read k times
+ * - Space Complexity: O(k)
+ *
+ * Why one pass is faster:
+ * - A large array does not fit in cache, so every scan is limited by memory bandwidth
+ * - One pass reads the array once; per-element work is a bit test (or a few SIMD compares)
+ *
+ * Use Cases:
+ * - Checking which of many IDs appear in a log / column
+ * - Semi-joins between a small list and a big unsorted table
+ */
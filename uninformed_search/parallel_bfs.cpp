@@ -0,0 +1,451 @@
+/*
+ * PARALLEL LEVEL-SYNCHRONOUS BREADTH-FIRST SEARCH
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: BFS that expands each level with a pool of threads
+ *
+ * Key Characteristics:
+ * - Level-synchronous: all threads expand level d, wait at a barrier, then expand level d + 1
+ * - The frontier is cut into chunks that threads claim from an atomic counter
+ * - Every edge to an unvisited vertex offers (queue position, edge offset) with an atomic
+ *   minimum; the smallest offer is the edge the serial queue would have used first
+ * - The new vertices are bucketed by the frontier chunk that won them and sorted inside each
+ *   chunk, so every frontier is in serial queue order
+ * - Same levels and parents as the serial bfs(), also on directed graphs, for any thread count
+ * - Worker threads are created once and reused for every search (thread pool)
+ *
+ * Time Complexity: O((V + E) / p + D) with p threads and D levels
+ * Space Complexity: O(V) - levels, parents, offers, frontiers and V-bit bitmaps
+ *
+ * Best for: Large graphs with wide levels on multi-core machines
+ * Worst for: Small graphs or long thin graphs (one barrier per level, little work per level)
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include "../common/csr_graph.h"
+#include "../common/graph_generators.h"
+using namespace std;
+
+/**
+ * Breadth-First Search Function (serial reference for levels and parents)
+ *
+ * A private loop rather than bfs() of common/search.h: it defines the serial parent order the
+ * parallel search must reproduce (parent[v] = first vertex in FIFO queue order with an edge to
+ * v) and fills plain level / parent arrays, which are compared element by element.
+ *
+ * @param start - starting node for traversal
+ * @param graph - graph in CSR form (see common/csr_graph.h)
+ * @param level - receives hop distances (-1 = unreachable)
+ * @param parent - receives the vertex each vertex was discovered from (-1 = none)
+ */
+void bfs(int start, const CsrGraph& graph, vector<int>& level, vector<int>& parent) {
+    level.assign(graph.numVertices(), -1);
+    parent.assign(graph.numVertices(), -1);
+    queue<int> q;
+    q.push(start);
+    level[start] = 0;
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        for (int neighbor : graph.neighbors(node)) {
+            if (level[neighbor] == -1) {
+                level[neighbor] = level[node] + 1;
+                parent[neighbor] = node;
+                q.push(neighbor);
+            }
+        }
+    }
+}
+
+/**
+ * Multi-threaded level-synchronous BFS with a persistent thread pool
+ */
+class ParallelBfs {
+public:
+    /**
+     * Start the worker threads
+     *
+     * @param threads - total threads used per search (including the caller)
+     * @param chunkSize - frontier vertices claimed at a time
+     */
+    explicit ParallelBfs(int threads = thread::hardware_concurrency(), int chunkSize = 256)
+        : numThreads(threads < 1 ? 1 : threads), chunk(chunkSize) {
+        // The calling thread also works, so start one worker fewer
+        for (int t = 1; t < numThreads; t++) {
+            workers.emplace_back(&ParallelBfs::workerLoop, this, t);
+        }
+    }
+
+    ~ParallelBfs() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        startCv.notify_all();
+        for (thread& w : workers) w.join();
+    }
+
+    ParallelBfs(const ParallelBfs&) = delete;
+    ParallelBfs& operator=(const ParallelBfs&) = delete;
+
+    /**
+     * Parallel BFS Function
+     *
+     * Same levels and parents as the serial bfs(): parent[v] is the vertex that discovers v first
+     * in serial queue order. Every frontier is kept in serial queue order; a vertex is offered
+     * by each edge that reaches it and keeps the smallest (queue position, edge offset) offer,
+     * so the result does not depend on the thread count or timing. Works on directed graphs.
+     *
+     * @param start - starting node for traversal
+     * @param graph - graph in CSR form (see common/csr_graph.h)
+     * @param level - receives hop distances (-1 = unreachable)
+     * @param parent - receives the parent of each vertex (-1 = start or unreachable)
+     */
+    void search(int start, const CsrGraph& graph, vector<int>& level, vector<int>& parent) {
+        int n = graph.numVertices();
+        level.resize(n);   // Cleared by the threads in work()
+        parent.resize(n);
+        if ((int)frontier.size() < n) {  // Buffers grow with the graph only; cleared in work()
+            visited = vector<atomic<uint64_t>>((n + 63) / 64);
+            offer = vector<atomic<uint64_t>>(n);
+            frontier.resize(n);
+            next.resize(n);
+            discovered.resize(n);
+            chunkCount = vector<atomic<int>>(n / chunk + 2);
+            chunkOffset.resize(n / chunk + 3);
+            offeredBy.assign(numThreads, vector<uint64_t>((n + 63) / 64));
+        }
+
+        {
+            lock_guard<mutex> lock(m);
+            jobGraph = &graph;
+            jobStart = start;
+            jobLevel = level.data();
+            jobParent = parent.data();
+            depth = 0;
+            running = numThreads - 1;
+            generation++;
+        }
+        startCv.notify_all();
+
+        work(0);  // Caller works too
+
+        unique_lock<mutex> lock(m);
+        doneCv.wait(lock, [this] { return running == 0; });
+    }
+
+    int threadCount() const { return numThreads; }
+
+private:
+    static const uint64_t NO_OFFER = UINT64_MAX;
+
+    /**
+     * Worker thread: wait for a new search, help with every level, report completion
+     */
+    void workerLoop(int id) {
+        long long seen = 0;
+        while (true) {
+            {
+                unique_lock<mutex> lock(m);
+                startCv.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            work(id);
+
+            lock_guard<mutex> lock(m);
+            if (--running == 0) doneCv.notify_one();
+        }
+    }
+
+    // Offer of the j-th edge of the vertex at serial queue position q (smaller = discovered first)
+    static uint64_t offerKey(long long q, int j) { return (uint64_t)q << 32 | (uint32_t)j; }
+
+    bool isVisited(int v) const { return visited[v >> 6].load(memory_order_relaxed) >> (v & 63) & 1; }
+
+    /**
+     * Clear this thread's share of the per-vertex arrays, then expand levels until the frontier
+     * is empty
+     */
+    void work(int id) {
+        const CsrGraph& graph = *jobGraph;
+        int n = graph.numVertices();
+        int perThread = (n + numThreads - 1) / numThreads;
+        for (int v = min(n, id * perThread); v < min(n, (id + 1) * perThread); v++) {
+            jobLevel[v] = -1;
+            jobParent[v] = -1;
+            offer[v].store(NO_OFFER, memory_order_relaxed);
+        }
+        int words = (n + 63) / 64, perThreadWords = (words + numThreads - 1) / numThreads;
+        for (int w = min(words, id * perThreadWords); w < min(words, (id + 1) * perThreadWords); w++) {
+            visited[w].store(0, memory_order_relaxed);
+        }
+        barrier([&] {
+            frontier[0] = jobStart;
+            frontierSize = 1;
+            frontierBase = 0;
+            jobLevel[jobStart] = 0;
+            visited[jobStart >> 6].store(uint64_t(1) << (jobStart & 63), memory_order_relaxed);
+            nextClaim.store(0);
+        });
+
+        vector<int> found;    // Vertices this thread offered first in the current level
+        vector<pair<uint64_t, int>> won;  // The same vertices with their final offers
+        vector<int> offered;  // Vertices this thread offered to in the current level
+        vector<uint64_t>& mine = offeredBy[id];  // Their bits; all zero between levels
+        while (true) {
+            int size = frontierSize;
+            if (size == 0) break;
+            int nextDepth = depth + 1;
+            int chunks = (size + chunk - 1) / chunk;
+            found.clear();
+            offered.clear();
+
+            // 1. Offers: every edge to a vertex not visited before this level proposes its
+            //    (queue position, edge offset); an atomic minimum keeps the serial bfs() choice.
+            //    The thread whose offer is the first for a vertex lists it (exactly one does).
+            //    A thread claims chunks in increasing order, so its own offers only grow: after
+            //    its first offer to a vertex it skips the vertex for the rest of the level
+            for (int c = nextClaim.fetch_add(1); c < chunks; c = nextClaim.fetch_add(1)) {
+                for (int i = c * chunk; i < min(size, (c + 1) * chunk); i++) {
+                    int j = 0;
+                    for (int neighbor : graph.neighbors(frontier[i])) {
+                        uint64_t bit = uint64_t(1) << (neighbor & 63);
+                        if (!isVisited(neighbor) && !(mine[neighbor >> 6] & bit)) {
+                            mine[neighbor >> 6] |= bit;
+                            offered.push_back(neighbor);
+                            uint64_t key = offerKey(frontierBase + i, j);
+                            atomic<uint64_t>& best = offer[neighbor];
+                            uint64_t current = best.load(memory_order_relaxed);
+                            while (key < current && !best.compare_exchange_weak(current, key, memory_order_relaxed)) {}
+                            if (current == NO_OFFER) found.push_back(neighbor);
+                        }
+                        j++;
+                    }
+                }
+            }
+            for (int v : offered) mine[v >> 6] = 0;
+            barrier([&] {
+                for (int c = 0; c < chunks; c++) chunkCount[c].store(0, memory_order_relaxed);
+                nextClaim.store(0);
+            });
+
+            // 2. Offers are final: count the new vertices won by each frontier chunk
+            won.clear();
+            for (int v : found) {
+                uint64_t key = offer[v].load(memory_order_relaxed);
+                chunkCount[((key >> 32) - frontierBase) / chunk].fetch_add(1, memory_order_relaxed);
+                won.push_back({key, v});
+            }
+            barrier([&] {
+                int total = 0;
+                for (int c = 0; c < chunks; c++) {
+                    chunkOffset[c] = total;
+                    total += chunkCount[c].load(memory_order_relaxed);
+                    chunkCount[c].store(chunkOffset[c], memory_order_relaxed);  // Now a write cursor
+                }
+                chunkOffset[chunks] = total;
+            });
+
+            // 3. Set level, parent and visited bit; scatter each vertex into its chunk's range
+            for (const auto& [key, v] : won) {
+                int i = (key >> 32) - frontierBase;
+                jobLevel[v] = nextDepth;
+                jobParent[v] = frontier[i];
+                visited[v >> 6].fetch_or(uint64_t(1) << (v & 63), memory_order_relaxed);
+                discovered[chunkCount[i / chunk].fetch_add(1, memory_order_relaxed)] = {key, v};
+            }
+            barrier([&] { nextClaim.store(0); });
+
+            // 4. Sort each chunk's range by offer: the next frontier is in serial queue order
+            for (int c = nextClaim.fetch_add(1); c < chunks; c = nextClaim.fetch_add(1)) {
+                auto first = discovered.begin() + chunkOffset[c], last = discovered.begin() + chunkOffset[c + 1];
+                sort(first, last);
+                for (auto it = first; it != last; ++it) next[it - discovered.begin()] = it->second;
+            }
+
+            // The last thread to arrive swaps the frontiers for everybody
+            barrier([&] {
+                frontier.swap(next);
+                frontierBase += size;
+                frontierSize = chunkOffset[chunks];
+                nextClaim.store(0);
+                depth++;
+            });
+        }
+    }
+
+    /**
+     * Wait until all threads arrive; the last one runs lastArrival() before releasing the others
+     */
+    template <typename Action>
+    void barrier(Action lastArrival) {
+        unique_lock<mutex> lock(m);
+        long long phase = barrierPhase;
+        if (++arrived == numThreads) {
+            lastArrival();
+            arrived = 0;
+            barrierPhase++;
+            barrierCv.notify_all();
+        } else {
+            barrierCv.wait(lock, [&] { return barrierPhase != phase; });
+        }
+    }
+
+    int numThreads;             // Threads per search, caller included
+    int chunk;                  // Frontier vertices per claim
+    vector<thread> workers;     // numThreads - 1 pool threads
+
+    // Current search (written before generation changes or inside the barrier)
+    const CsrGraph* jobGraph = nullptr;
+    int jobStart = 0;
+    int* jobLevel = nullptr;
+    int* jobParent = nullptr;
+    int depth = 0;                // Level of the current frontier
+    vector<int> frontier;         // Current level (first frontierSize entries), serial queue order
+    int frontierSize = 0;
+    long long frontierBase = 0;   // Serial queue position of frontier[0]
+    vector<int> next;             // Next level, built from discovered
+    vector<pair<uint64_t, int>> discovered;  // (offer, vertex) of the next level, grouped by chunk
+    vector<atomic<int>> chunkCount;  // New vertices per frontier chunk, then write cursors
+    vector<int> chunkOffset;      // Start of each chunk's range in discovered / next
+    vector<atomic<uint64_t>> visited;  // Vertices of earlier levels (bits set by the winners)
+    vector<atomic<uint64_t>> offer;    // Smallest offerKey seen for each vertex
+    vector<vector<uint64_t>> offeredBy;  // Per thread: vertices it offered to in the current level
+    atomic<int> nextClaim{0};     // Next chunk to hand out
+
+    mutex m;
+    condition_variable startCv, doneCv, barrierCv;
+    long long generation = 0;   // Incremented for every new search
+    int running = 0;            // Workers still busy with the current search
+    bool stopping = false;
+    int arrived = 0;            // Threads waiting at the barrier
+    long long barrierPhase = 0; // Incremented every time the barrier opens
+};
+
+int main(int argc, char* argv[]) {
+    int n = 6; // Number of nodes in graph
+    vector<vector<int>> adjacency(n);
+
+    // Same undirected graph as breadth_first_search.cpp
+    adjacency[0] = {1, 2};
+    adjacency[1] = {0, 3, 4};
+    adjacency[2] = {0};
+    adjacency[3] = {1};
+    adjacency[4] = {1, 5};
+    adjacency[5] = {4};
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);
+
+    ParallelBfs small(2, 1);  // One-vertex chunks so both threads take part
+    vector<int> level, parent;
+    small.search(0, graph, level, parent);
+    cout << "Parallel BFS from node 0:\n";
+    for (int v = 0; v < n; v++) cout << "Node " << v << ": level " << level[v] << ", parent " << parent[v] << endl;
+
+    // Strong scaling on an R-MAT graph with about 10^8 directed edges (2^22 vertices, 12 x 2 per vertex)
+    int scale = argc > 1 ? atoi(argv[1]) : 22;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    GeneratedGraph rmat = generateRmat(scale, 12, 1, 42);
+    int start = largestComponentVertex(rmat.graph);
+    cout << "\nR-MAT graph: " << rmat.graph.numVertices() << " vertices, " << rmat.graph.numEdges() << " edges\n";
+
+    vector<int> expectedLevel, expectedParent;
+    auto begin = chrono::steady_clock::now();
+    bfs(start, rmat.graph, expectedLevel, expectedParent);
+    double serial = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    cout << "  serial bfs:   " << serial * 1000 << " ms\n";
+
+    // Correctness: same levels and parents as bfs() for several thread counts, on the R-MAT graph
+    // and on a directed graph (where neighbors are not in-edges)
+    vector<WeightedEdge> arcs;
+    mt19937 rng(7);
+    int directedVertices = 1 << 16;
+    for (int e = 0; e < 4 * directedVertices; e++) {
+        arcs.push_back({(int)(rng() % directedVertices), (int)(rng() % directedVertices), 1});
+    }
+    CsrGraph directed = CsrGraph::fromWeightedEdges(directedVertices, arcs);
+    vector<int> directedLevel, directedParent;
+    bfs(0, directed, directedLevel, directedParent);
+
+    bool ok = true;
+    for (int threads : {1, 2, 3, 8}) {
+        ParallelBfs searcher(threads, 64);
+        searcher.search(start, rmat.graph, level, parent);
+        ok = ok && level == expectedLevel && parent == expectedParent;
+        searcher.search(0, directed, level, parent);  // Smaller graph: buffers are reused
+        ok = ok && level == directedLevel && parent == directedParent;
+    }
+    cout << "Correctness check: " << (ok ? "OK" : "MISMATCH") << endl;
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    double single = 0;
+    for (int threads : threadCounts) {
+        ParallelBfs searcher(threads);
+        double best = 1e30;
+        for (int r = 0; r < 3; r++) {
+            begin = chrono::steady_clock::now();
+            searcher.search(start, rmat.graph, level, parent);
+            best = min(best, chrono::duration<double>(chrono::steady_clock::now() - begin).count());
+        }
+        if (threads == 1) single = best;
+        cout << "  " << threads << " thread(s): " << best * 1000 << " ms, "
+             << rmat.graph.numEdges() / best / 1e6 << " M edges/s, speedup " << single / best << "x\n";
+    }
+
+    return ok ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Code Breakdown:
+ * - nextClaim.fetch_add(1) - threads claim frontier chunks dynamically (hub vertices of
+ *   power-law graphs make static splits uneven)
+ * - offer[v] compare-exchange - keeps the smallest (queue position, edge offset); a plain load
+ *   of the visited bitmap filters vertices of earlier levels without a write
+ * - offeredBy[id] - a thread claims chunks in increasing order, so its second offer to a vertex
+ *   can never win; a thread-local bitmap skips it
+ * - chunkCount[c] - new vertices per winning chunk; after the prefix sum it is the write cursor
+ *   of the chunk's range, sorted by offer afterwards
+ * - barrier() - four per level; the last thread to arrive runs the serial step (prefix sum,
+ *   frontier swap)
+ *
+ * Determinism:
+ * - Levels never depend on timing: a vertex is found in the first level that reaches it
+ * - The winning offer is a minimum, so it does not depend on the order of the atomic updates;
+ *   with the frontier in serial queue order it is exactly the edge bfs() takes, so parents and
+ *   the frontier order match the serial search for every thread count
+ * - The price: the offers, the per-chunk sort and two more barriers per level make one thread
+ *   1.5-2x slower than the serial bfs() on R-MAT
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O((V + E) / p + D) - D barriers, one per level
+ * - Space Complexity: O(V) - level, parent, 8-byte offers, frontiers, visited and per-thread
+ *   offered bitmaps; all kept between searches and reallocated only when V grows
+ *
+ * Performance Notes:
+ * - BFS is memory-latency bound; speedup follows the number of outstanding cache misses the
+ *   cores can sustain, usually below the core count
+ * - The bitmap keeps the visited set 32x smaller than an int per vertex, so it mostly stays in cache
+ *
+ * Use Cases:
+ * - Hop distances and BFS trees on graphs with hundreds of millions of edges
+ * - Graph500-style benchmarks
+ */
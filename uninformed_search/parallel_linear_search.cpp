@@ -0,0 +1,248 @@
+/*
+ * PARALLEL LINEAR SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Linear Search split into chunks that a pool of threads scans at the same time
+ *
+ * Key Characteristics:
+ * - Array is cut into fixed-size chunks; threads take chunks in increasing order
+ * - Returns the LOWEST matching index, exactly like linearSearch()
+ * - A shared atomic "best index" lets threads skip every chunk that starts after a match
+ * - Worker threads are created once and reused for every search (thread pool)
+ * - Number of threads and chunk size are configurable
+ *
+ * Time Complexity: O(n / p) with p threads (worst case), O(1) best case
+ * Space Complexity: O(p) - one thread per core
+ *
+ * Best for: Very large unsorted arrays (hundreds of millions of elements)
+ * Worst for: Small arrays (waking the threads costs more than the scan)
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdlib>
+#include "../common/array_search.h"
+using namespace std;
+
+/**
+ * Multi-threaded Linear Search with a persistent thread pool
+ */
+class ParallelLinearSearch {
+public:
+    /**
+     * Start the worker threads
+     *
+     * @param threads - total threads used per search (including the caller)
+     * @param chunkSize - elements per chunk (unit of work and of early cancellation)
+     */
+    explicit ParallelLinearSearch(int threads = thread::hardware_concurrency(), int chunkSize = 1 << 16)
+        : numThreads(threads < 1 ? 1 : threads), chunk(chunkSize) {
+        // The calling thread also scans, so start one worker fewer
+        for (int t = 1; t < numThreads; t++) {
+            workers.emplace_back(&ParallelLinearSearch::workerLoop, this);
+        }
+    }
+
+    ~ParallelLinearSearch() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        startCv.notify_all();
+        for (thread& w : workers) w.join();
+    }
+
+    ParallelLinearSearch(const ParallelLinearSearch&) = delete;
+    ParallelLinearSearch& operator=(const ParallelLinearSearch&) = delete;
+
+    /**
+     * Parallel Linear Search Function
+     *
+     * @param arr[] - input array to search in
+     * @param size - size of the array
+     * @param target - value to search for
+     * @return index of the first occurrence of target, -1 if not found
+     */
+    int search(const int arr[], int size, int target) {
+        {
+            lock_guard<mutex> lock(m);
+            jobArr = arr;
+            jobSize = size;
+            jobTarget = target;
+            nextChunk.store(0);
+            best.store(INT_MAX);
+            running = numThreads - 1;
+            generation++;
+        }
+        startCv.notify_all();
+
+        scanChunks();  // Caller works too
+
+        unique_lock<mutex> lock(m);
+        doneCv.wait(lock, [this] { return running == 0; });
+        int found = best.load();
+        return found == INT_MAX ? -1 : found;
+    }
+
+    int threadCount() const { return numThreads; }
+
+private:
+    /**
+     * Worker thread: wait for a new search, help scan it, report completion
+     */
+    void workerLoop() {
+        long long seen = 0;
+        while (true) {
+            {
+                unique_lock<mutex> lock(m);
+                startCv.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            scanChunks();
+
+            lock_guard<mutex> lock(m);
+            if (--running == 0) doneCv.notify_one();
+        }
+    }
+
+    /**
+     * Claim chunks in increasing order and scan them until none can beat the best match
+     */
+    void scanChunks() {
+        while (true) {
+            long long begin = (long long)nextChunk.fetch_add(1) * chunk;
+            // Chunks are handed out in order, so once a match is known every
+            // later chunk starts at a higher index and can be skipped
+            if (begin >= jobSize || begin >= best.load(memory_order_relaxed)) return;
+            int end = (int)min<long long>(jobSize, begin + chunk);
+
+            for (int i = (int)begin; i < end; i++) {
+                if (jobArr[i] == jobTarget) {
+                    // Keep the smallest index: lower an atomic minimum
+                    int current = best.load();
+                    while (i < current && !best.compare_exchange_weak(current, i)) {
+                    }
+                    break;  // Rest of this chunk can only hold higher indexes
+                }
+            }
+        }
+    }
+
+    int numThreads;             // Threads per search, caller included
+    int chunk;                  // Elements per chunk
+    vector<thread> workers;     // numThreads - 1 pool threads
+
+    // Current search (written under the mutex before generation changes)
+    const int* jobArr = nullptr;
+    int jobSize = 0;
+    int jobTarget = 0;
+    atomic<int> nextChunk{0};   // Next chunk to hand out
+    atomic<int> best{INT_MAX};  // Lowest matching index found so far
+
+    mutex m;
+    condition_variable startCv, doneCv;
+    long long generation = 0;   // Incremented for every new search
+    int running = 0;            // Workers still scanning the current search
+    bool stopping = false;
+};
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile int benchmarkSink;
+
+int main(int argc, char* argv[]) {
+    // Sample data array (unsorted) - same example as linear_search.cpp
+    int data[] = {10, 25, 30, 45, 50};
+    int size = sizeof(data) / sizeof(data[0]);
+
+    ParallelLinearSearch small(2, 2);  // Tiny chunks so both threads take part
+    cout << "Search 45 in small array: index " << small.search(data, size, 45) << endl;
+    cout << "Search 99 in small array: index " << small.search(data, size, 99) << endl;
+
+    // Scaling benchmark: 1..maxThreads threads (default: all cores)
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+
+    const int n = 1 << 26; // 64M ints = 256 MB
+    vector<int> column(n);
+    mt19937 rng(42);
+    for (int& x : column) x = rng() % 1000000;
+
+    // Correctness against linearSearch() with several thread counts
+    int mismatches = 0;
+    for (int threads : {1, 2, 3, 8}) {
+        ParallelLinearSearch searcher(threads, 1 << 12);
+        for (int t = 0; t < 200; t++) {
+            int target = rng() % 1100000;  // Some targets never occur
+            int len = rng() % (1 << 18);
+            if (searcher.search(column.data(), len, target) != linearSearch(column.data(), len, target)) {
+                mismatches++;
+            }
+        }
+    }
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    const int repeats = 5;
+    double single = 0;
+    cout << "\nScaling over " << n << " ints (target absent, full scan):\n";
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        ParallelLinearSearch searcher(threads);
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++) benchmarkSink = searcher.search(column.data(), n, -1 - r);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count() / repeats;
+        if (threads == 1) single = seconds;
+        cout << "  " << threads << " thread(s): " << seconds * 1000 << " ms/search, "
+             << n / seconds / 1e9 << " G elements/s, speedup " << single / seconds << "x\n";
+    }
+
+    // Early cancellation: match near the start stops every thread quickly
+    column[1000] = -7;
+    ParallelLinearSearch searcher(maxThreads);
+    auto start = chrono::steady_clock::now();
+    int index = searcher.search(column.data(), n, -7);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "\nEarly match at index " << index << " found in " << seconds * 1e6 << " us" << endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Code Breakdown:
+ * - nextChunk.fetch_add(1) - each thread claims the next unscanned chunk (dynamic scheduling)
+ * - best - atomic minimum of all match positions found so far
+ * - begin >= best - chunks are claimed in increasing order, so every chunk claimed after
+ *   a match starts past it and is skipped; only lower chunks still in progress finish
+ * - compare_exchange_weak loop - lowers best without a lock when several threads match
+ *
+ * Thread Pool:
+ * - Workers are started once in the constructor and sleep on a condition variable
+ * - search() publishes the job, wakes the workers, scans with them and waits for them
+ *
+ * Complexity Analysis:
+ * - Time Complexity: O(n / p) worst case with p threads, until memory bandwidth is saturated
+ * - Best Case: O(chunk) - match in the first chunk
+ * - Space Complexity: O(p) - worker threads
+ *
+ * Performance Notes:
+ * - A full scan is memory-bandwidth bound; speedup stops growing once all memory
+ *   channels are busy (often well below the core count)
+ * - Larger chunks lower the scheduling overhead; smaller chunks cancel faster
+ *
+ * Use Cases:
+ * - Scanning huge in-memory columns
+ * - Searching data that cannot be sorted or indexed
+ */
@@ -0,0 +1,262 @@
+/*
+ * SIMD LINEAR SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Linear Search that compares 16 array elements per step using SIMD instructions
+ *
+ * Key Characteristics:
+ * - Same result as Linear Search: index of the FIRST match, or -1
+ * - Compares 16 ints per loop iteration (2 x AVX2 or 4 x SSE4.2 registers)
+ * - Kernel (AVX2 / SSE4.2 / scalar) is chosen once at startup from the CPU features
+ * - Only one branch per 16 elements instead of one per element
+ * - Falls back to the plain scalar loop on non-x86 CPUs
+ *
+ * Time Complexity: O(n) - still linear, but ~n/16 loop iterations
+ * Space Complexity: O(1) - constant space
+ *
+ * Best for: Large unsorted int arrays that are scanned often
+ * Worst for: Tiny arrays (dispatch overhead dominates) or sorted arrays (use Binary Search)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_LINEAR_SEARCH_X86 1
+#endif
+#include "../common/array_search.h"
+using namespace std;
+
+/**
+ * Scalar Linear Search (dispatch fallback when no SIMD kernel is available; same loop as
+ * linearSearch() of common/array_search.h, with the kernel signature)
+ *
+ * @param arr[] - input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @return index of target if found, -1 if not found
+ */
+int linearSearchScalar(int arr[], int size, int target) {
+    for (int i = 0; i < size; i++) {
+        if (arr[i] == target) {
+            return i; // Found: return the index of target
+        }
+    }
+    return -1; // Not found: return -1
+}
+
+#ifdef SIMD_LINEAR_SEARCH_X86
+/**
+ * AVX2 Linear Search kernel: 16 ints (two 256-bit registers) per iteration
+ *
+ * @param arr[] - input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @return index of target if found, -1 if not found
+ */
+__attribute__((target("avx2")))
+int linearSearchAvx2(int arr[], int size, int target) {
+    const __m256i needle = _mm256_set1_epi32(target); // target copied into all 8 lanes
+    int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m256i lo = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), needle);
+        __m256i hi = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), needle);
+
+        // One branch for all 16 comparisons
+        if (!_mm256_testz_si256(_mm256_or_si256(lo, hi), _mm256_or_si256(lo, hi))) {
+            int maskLo = _mm256_movemask_ps(_mm256_castsi256_ps(lo));
+            if (maskLo) return i + __builtin_ctz(maskLo);   // First matching lane
+            int maskHi = _mm256_movemask_ps(_mm256_castsi256_ps(hi));
+            return i + 8 + __builtin_ctz(maskHi);
+        }
+    }
+
+    // Remaining (size % 16) elements
+    for (; i < size; i++) {
+        if (arr[i] == target) return i;
+    }
+    return -1;
+}
+
+/**
+ * SSE4.2 Linear Search kernel: 16 ints (four 128-bit registers) per iteration
+ *
+ * @param arr[] - input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @return index of target if found, -1 if not found
+ */
+__attribute__((target("sse4.2")))
+int linearSearchSse42(int arr[], int size, int target) {
+    const __m128i needle = _mm_set1_epi32(target); // target copied into all 4 lanes
+    int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), needle);
+        __m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 4)), needle);
+        __m128i c2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 8)), needle);
+        __m128i c3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i + 12)), needle);
+        __m128i any = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+
+        // One branch for all 16 comparisons
+        if (!_mm_testz_si128(any, any)) {
+            // Build a 16-bit mask (bit k = lane k matched) and take the lowest set bit
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(c0))
+                     | _mm_movemask_ps(_mm_castsi128_ps(c1)) << 4
+                     | _mm_movemask_ps(_mm_castsi128_ps(c2)) << 8
+                     | _mm_movemask_ps(_mm_castsi128_ps(c3)) << 12;
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    // Remaining (size % 16) elements
+    for (; i < size; i++) {
+        if (arr[i] == target) return i;
+    }
+    return -1;
+}
+#endif
+
+// Signature shared by every kernel
+using LinearSearchKernel = int (*)(int[], int, int);
+
+/**
+ * Pick the fastest kernel supported by the running CPU
+ *
+ * @param name - receives a printable name of the chosen kernel
+ * @return pointer to the chosen kernel
+ */
+LinearSearchKernel selectLinearSearchKernel(const char*& name) {
+#ifdef SIMD_LINEAR_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        name = "AVX2";
+        return linearSearchAvx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        name = "SSE4.2";
+        return linearSearchSse42;
+    }
+#endif
+    name = "scalar";
+    return linearSearchScalar;
+}
+
+// Kernel is chosen once at program startup, not on every call
+const char* linearSearchKernelName = "";
+const LinearSearchKernel linearSearchKernel = selectLinearSearchKernel(linearSearchKernelName);
+
+/**
+ * SIMD Linear Search Function (runtime-dispatched)
+ *
+ * @param arr[] - input array to search in
+ * @param size - size of the array
+ * @param target - value to search for
+ * @return index of the first occurrence of target, -1 if not found
+ */
+int linearSearchSimd(int arr[], int size, int target) {
+    return linearSearchKernel(arr, size, target);
+}
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile int benchmarkSink;
+
+/**
+ * Throughput benchmark: scan the whole array for a missing value several times
+ *
+ * @param name - label printed in the report
+ * @param search - kernel to benchmark
+ * @param data - array to scan
+ * @param repeats - number of full scans
+ * @return elements scanned per second
+ */
+double benchmarkKernel(const char* name, LinearSearchKernel search, vector<int>& data, int repeats) {
+    int size = data.size();
+
+    auto begin = chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        benchmarkSink = search(data.data(), size, -1 - r); // Negative targets never occur: full scan
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    double elementsPerSecond = (double)size * repeats / seconds;
+    cout << "  " << name << ": " << elementsPerSecond / 1e9 << " G elements/s ("
+         << elementsPerSecond * sizeof(int) / 1e9 << " GB/s)\n";
+    return elementsPerSecond;
+}
+
+int main() {
+    cout << "Selected kernel: " << linearSearchKernelName << endl;
+
+    // Sample data array (unsorted) - same example as linear_search.cpp
+    int data[] = {10, 25, 30, 45, 50};
+    int size = sizeof(data) / sizeof(data[0]);
+    cout << "Search 45 in small array: index " << linearSearchSimd(data, size, 45) << endl;
+
+    // Large unsorted column of non-negative values
+    const int n = 1 << 24; // 16M ints = 64 MB
+    vector<int> column(n);
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(0, 1 << 20);
+    for (int& x : column) x = dist(rng);
+
+    // Correctness: SIMD kernel must return exactly the same index as linearSearch()
+    int mismatches = 0;
+    for (int t = 0; t < 1000; t++) {
+        int target = dist(rng);
+        int len = rng() % 4096; // Short prefixes exercise the scalar tail
+        if (linearSearchSimd(column.data(), len, target) != linearSearch(column.data(), len, target)) {
+            mismatches++;
+        }
+    }
+    for (int t = 0; t < 20; t++) {
+        int target = dist(rng);
+        if (linearSearchSimd(column.data(), n, target) != linearSearch(column.data(), n, target)) {
+            mismatches++;
+        }
+    }
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    // Throughput benchmark (worst case: target absent, whole array scanned)
+    cout << "\nThroughput over " << n << " ints:\n";
+    const int repeats = 10;
+    double scalar = benchmarkKernel("scalar", linearSearchScalar, column, repeats);
+    double simd = benchmarkKernel(linearSearchKernelName, linearSearchKernel, column, repeats);
+    cout << "Speedup: " << simd / scalar << "x" << endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Code Breakdown:
+ * - _mm256_set1_epi32(target) - copy target into every SIMD lane
+ * - _mm256_cmpeq_epi32(block, needle) - compare 8 elements at once (all-ones lane on match)
+ * - _mm256_testz_si256(...) - single branch: "did any of the 16 lanes match?"
+ * - _mm256_movemask_ps + __builtin_ctz - position of the first matching lane
+ * - Scalar tail loop - handles the last size % 16 elements
+ *
+ * Runtime Dispatch:
+ * - __builtin_cpu_supports("avx2") / ("sse4.2") queried once at startup
+ * - Kernels are compiled with __attribute__((target(...))), so no -mavx2 flag is needed
+ *   and the binary still runs on CPUs without AVX2
+ *
+ * Complexity Analysis:
+ * - Best Case: O(1) - target in the first 16 elements
+ * - Average Case: O(n/2) - same comparisons as Linear Search, 16 at a time
+ * - Worst Case: O(n) - target at end or not found
+ * - Space Complexity: O(1) - constant extra space
+ *
+ * Performance Notes:
+ * - Large arrays become memory-bandwidth bound; SIMD removes the per-element branch
+ *   so the scan can run at close to memory speed
+ * - Returns the first match, so results are identical to linearSearch()
+ *
+ * Use Cases:
+ * - Scanning large unsorted columns (analytics, filtering)
+ * - Hot loops that call Linear Search on big arrays
+ */
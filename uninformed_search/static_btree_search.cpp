@@ -0,0 +1,273 @@
+/*
+ * STATIC B+-TREE (S-TREE) SEARCH ALGORITHM
+ *
+ * Category: Uninformed Search (Blind Search)
+ * Description: Read-only B+-tree built from a sorted array, with 16 keys (one cache line) per node
+ *
+ * Key Characteristics:
+ * - Built once from a sorted array; no pointers, children are found by arithmetic
+ * - Every node is 16 ints = 64 bytes = exactly one cache line
+ * - Each node is searched with SIMD compares (count of keys < target = child to follow)
+ * - A lookup touches about log17(n) cache lines instead of log2(n)
+ * - Leaf layer is a padded copy of the sorted array (same positions), so results are original
+ *   indexes; the caller's array is not referenced after construction
+ * - Supports lower_bound queries and binarySearch()-style exact match (-1 if missing)
+ *
+ * Time Complexity: O(log n) per lookup (~log17 n node visits), O(n) to build
+ * Space Complexity: O(n) - full copy of the array (leaf layer) plus ~1/16 for internal nodes
+ *
+ * Best for: Many lookups into large, rarely changing sorted arrays
+ * Worst for: Arrays that change often (tree must be rebuilt)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "../common/array_search.h"
+using namespace std;
+
+/**
+ * Count how many of the 16 sorted keys in a node are smaller than target
+ * (= position of the lower bound inside the node = child to descend into)
+ *
+ * Uses AVX2 when compiled with -mavx2 / -march=native, SSE2 on any other x86-64
+ * (SSE2 is part of the x86-64 baseline), and a plain loop elsewhere.
+ *
+ * @param node - 64-byte aligned node of 16 keys
+ * @param target - value to search for
+ * @return number of keys < target (0..16)
+ */
+inline int nodeRank(const int* node, int target) {
+#if defined(__AVX2__)
+    __m256i x = _mm256_set1_epi32(target);
+    __m256i lo = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)node));
+    __m256i hi = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)(node + 8)));
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(lo))
+             | _mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8;
+    return __builtin_popcount(mask);
+#elif defined(__SSE2__)
+    __m128i x = _mm_set1_epi32(target);
+    __m128i c0 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)node));
+    __m128i c1 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(node + 4)));
+    __m128i c2 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(node + 8)));
+    __m128i c3 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(node + 12)));
+    // Narrow 16 x 32-bit results to 16 x 8-bit so one movemask covers the whole node
+    __m128i packed = _mm_packs_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+    return __builtin_popcount(_mm_movemask_epi8(packed));
+#else
+    int count = 0;
+    for (int j = 0; j < 16; j++) count += node[j] < target;
+    return count;
+#endif
+}
+
+/**
+ * Static B+-tree ("S+ tree") over a sorted int array
+ *
+ * Layer 0 holds a copy of the sorted keys (padded with INT_MAX to whole nodes); every layer above
+ * holds, for each node, the smallest key of each of its children 1..16. All layers are
+ * stored in one aligned array: node j of layer h has children j*17 .. j*17+16 in layer h-1.
+ */
+class StaticBTree {
+public:
+    static const int B = 16; // Keys per node (16 x 4 bytes = one 64-byte cache line)
+
+    /**
+     * Build the tree from a sorted array
+     *
+     * @param arr[] - sorted input array
+     * @param size - size of the array
+     */
+    StaticBTree(const int arr[], int size) : n(size) {
+        // Layer sizes from the leaves up, until one node is enough
+        int keys = n;
+        layerOffset.push_back(0);
+        while (true) {
+            layerOffset.push_back(layerOffset.back() + (size_t)blocks(keys) * B);
+            if (keys <= B) break;
+            keys = prevKeys(keys);
+        }
+        height = layerOffset.size() - 1;
+
+        totalKeys = max(layerOffset.back(), (size_t)B);
+        tree = static_cast<int*>(aligned_alloc(64, totalKeys * sizeof(int)));
+        fill(tree, tree + totalKeys, INT_MAX);
+        copy(arr, arr + n, tree);
+
+        // Internal key = first key of the subtree right of it (child j + 1)
+        for (int h = 1; h < height; h++) {
+            size_t layerSize = layerOffset[h + 1] - layerOffset[h];
+            for (size_t i = 0; i < layerSize; i++) {
+                long long k = i / B, j = i % B;
+                k = k * (B + 1) + j + 1;                       // Right child in layer h-1
+                for (int l = 1; l < h; l++) k *= (B + 1);      // Its leftmost leaf node
+                tree[layerOffset[h] + i] = (k * B < n) ? tree[k * B] : INT_MAX;
+            }
+        }
+    }
+
+    ~StaticBTree() { free(tree); }
+
+    StaticBTree(const StaticBTree&) = delete;
+    StaticBTree& operator=(const StaticBTree&) = delete;
+
+    /**
+     * Lower bound: first position whose value is >= target
+     *
+     * @param target - value to search for
+     * @return index in the original sorted array, or size if every value is smaller
+     */
+    int lowerBound(int target) const {
+        size_t k = 0; // Offset of the current node inside its layer
+        for (int h = height - 1; h > 0; h--) {
+            int i = nodeRank(tree + layerOffset[h] + k, target);
+            k = k * (B + 1) + (size_t)i * B;  // Offset of child i in the layer below
+        }
+        size_t index = k + nodeRank(tree + k, target);
+        return index < (size_t)n ? (int)index : n;
+    }
+
+    /**
+     * Exact-match search with binarySearch() semantics
+     *
+     * @param target - value to search for
+     * @return index of target if found, -1 if not found
+     *         (the first occurrence when the array has duplicates)
+     */
+    int find(int target) const {
+        int index = lowerBound(target);
+        return (index < n && tree[index] == target) ? index : -1;
+    }
+
+    int levels() const { return height; }
+
+    // Total bytes used by the tree (leaf copy + internal nodes + padding)
+    size_t memoryBytes() const { return totalKeys * sizeof(int); }
+
+    /**
+     * Print how much memory the tree needs compared with the plain sorted array
+     */
+    void printMemoryReport() const {
+        size_t raw = (size_t)n * sizeof(int);
+        size_t leaves = layerOffset[1] * sizeof(int);
+        size_t internal = memoryBytes() - leaves;
+        cout << "S-tree memory report (" << n << " keys, " << height << " levels):\n"
+             << "  sorted array:   " << raw / 1048576.0 << " MB\n"
+             << "  leaf layer:     " << leaves / 1048576.0 << " MB (copy + padding)\n"
+             << "  internal nodes: " << internal / 1048576.0 << " MB\n"
+             << "  total:          " << memoryBytes() / 1048576.0 << " MB (tree only, leaf copy included)\n"
+             << "  with the array: " << (memoryBytes() + raw) / 1048576.0 << " MB (caller keeps its array)\n"
+             << "  overhead vs array: "
+             << (raw ? 100.0 * (memoryBytes() - raw) / raw : 0.0) << "% (if the array is freed), "
+             << (raw ? 100.0 * memoryBytes() / raw : 0.0) << "% (if it is kept alongside)\n";
+    }
+
+private:
+    static int blocks(int keys) { return (keys + B - 1) / B; }
+    static int prevKeys(int keys) { return (blocks(keys) + B) / (B + 1) * B; }
+
+    int n;                       // Number of keys
+    int height;                  // Number of layers (cache lines touched per lookup)
+    size_t totalKeys;            // Size of tree[] in ints
+    vector<size_t> layerOffset;  // Start of each layer in tree[] (layer 0 = leaves)
+    int* tree;                   // All layers, 64-byte aligned
+};
+
+// Benchmark results are written here so the compiler cannot discard the calls
+volatile int benchmarkSink;
+
+int main() {
+    // Sample data array (MUST be sorted) - same example as binary_search.cpp
+    int data[] = {10, 20, 30, 40, 50, 60};
+    int size = sizeof(data) / sizeof(data[0]);
+
+    StaticBTree small(data, size);
+    for (int target : {10, 35, 60, 70}) {
+        int result = small.find(target);
+        cout << "find(" << target << ") = " << result
+             << ", lowerBound(" << target << ") = " << small.lowerBound(target) << endl;
+    }
+
+    // Large sorted table with unique keys
+    const int n = 1 << 24; // 16M ints = 64 MB
+    vector<int> sorted(n);
+    for (int i = 0; i < n; i++) sorted[i] = 3 * i + 1;
+
+    auto buildStart = chrono::steady_clock::now();
+    StaticBTree tree(sorted.data(), n);
+    double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - buildStart).count();
+    cout << "\nBuilt S-tree in " << buildSeconds << " s\n";
+    tree.printMemoryReport();
+
+    int binaryLevels = 0;
+    while ((1LL << binaryLevels) <= n) binaryLevels++;
+    cout << "Cache lines per lookup: ~" << tree.levels() << " (binarySearch: ~" << binaryLevels << ")\n";
+
+    // Random queries: about half hit, half miss
+    const int queries = 1 << 22;
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(0, 3 * n);
+    vector<int> targets(queries);
+    for (int& t : targets) t = dist(rng);
+
+    // Correctness against binarySearch() and std::lower_bound
+    int mismatches = 0;
+    for (int i = 0; i < 100000; i++) {
+        int t = targets[i];
+        if (tree.find(t) != binarySearch(sorted.data(), n, t)) mismatches++;
+        if (tree.lowerBound(t) != lower_bound(sorted.begin(), sorted.end(), t) - sorted.begin()) mismatches++;
+    }
+    cout << "Correctness check: " << (mismatches == 0 ? "OK" : "MISMATCH") << endl;
+
+    auto start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = binarySearch(sorted.data(), n, t);
+    double classic = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (int t : targets) benchmarkSink = tree.find(t);
+    double stree = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "binarySearch: " << classic * 1e9 / queries << " ns/lookup" << endl;
+    cout << "StaticBTree:  " << stree * 1e9 / queries << " ns/lookup" << endl;
+    cout << "Speedup: " << classic / stree << "x" << endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * ALGORITHM ANALYSIS:
+ *
+ * Layout:
+ * - Layer 0: a copy of the sorted array, padded with INT_MAX to a multiple of 16
+ * - Layer h: one 16-key node per 17 nodes of layer h-1; key j is the smallest key
+ *   in child j + 1, so "number of keys < target" is the child to follow
+ * - No child pointers: child i of the node at offset k is at offset k * 17 + i * 16
+ *
+ * Code Breakdown:
+ * - nodeRank(node, target) - compare target with all 16 keys at once (_mm256_cmpgt_epi32),
+ *   turn the result into a bit mask (movemask) and count the bits (popcount)
+ * - k = k * (B + 1) + i * B - jump to child i in the next layer
+ * - Final nodeRank in layer 0 gives the lower bound directly as an array index
+ *
+ * Complexity Analysis:
+ * - Build: O(n) time
+ * - Lookup: O(log17 n) node visits, each a single cache line and no branches inside the node
+ * - Space Complexity: O(n) - about n * (1 + 1/16) ints
+ *
+ * Comparison with Binary Search (16M keys):
+ * - binarySearch(): ~24 dependent probes, most of them cache misses
+ * - StaticBTree: 6 node visits, the top layers stay in cache
+ *
+ * Use Cases:
+ * - Read-only database / analytics indexes
+ * - Lookup tables that are built once and queried many times
+ */
@@ -20,72 +20,62 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <utility> // for pair
+#include "../common/csr_graph.h"
+#include "../common/search.h"
 using namespace std;
 
 // Edge structure: pair<destination, cost>
 using Edge = pair<int, int>;
 
-/**
- * Uniform Cost Search Function
- * 
- * @param start - starting node for search
- * @param graph - weighted graph represented as adjacency list
+/*
+ * ucs(start, graph, goal = -1) lives in common/search.h. The queue is the first template
+ * argument: HeapQueue (binary heap, default), IndexedHeap (decrease-key, at most V entries),
+ * RadixHeap or BucketQueue for small integer weights (see common/priority_queues.h). Without a
+ * goal it settles every reachable node and leaves the minimum costs in the workspace.
  */
-void ucs(int start, const vector<vector<Edge>>& graph) {
-    int n = graph.size();
-    vector<bool> visited(n, false);           // Track visited nodes
-    vector<int> cost(n, INT_MAX);             // Store minimum cost to reach each node
-
-    // Min-heap priority queue: orders by cost (lowest first)
-    priority_queue<Edge, vector<Edge>, greater<Edge>> pq;
-
-    cost[start] = 0;                          // Cost to start node is 0
-    pq.push({0, start});                      // Add start node to priority queue
-
-    while (!pq.empty()) {
-        int currCost = pq.top().first;        // Get current cost
-        int node = pq.top().second;           // Get current node
-        pq.pop();                             // Remove from priority queue
-
-        if (visited[node]) continue;          // Skip if already visited
-        visited[node] = true;                 // Mark as visited
-
-        cout << "Visited node: " << node << " with cost = " << currCost << endl;
-
-        // Explore all neighbors of current node
-        for (auto [neighbor, weight] : graph[node]) {
-            int newCost = currCost + weight;  // Calculate new cost through current node
-            if (newCost < cost[neighbor]) {   // If this path is better
-                cost[neighbor] = newCost;     // Update minimum cost
-                pq.push({newCost, neighbor}); // Add to priority queue
-            }
-        }
+struct PrintVisits : NoTrace {
+    static void expand(const SearchStep& step) {
+        cout << "Visited node: " << step.node << " with cost = " << step.g << endl;
     }
+};
 
-    // Display results
+// Display the minimum costs left in the workspace by the last search
+void printCosts(int start, int n) {
+    const SearchWorkspace& workspace = SearchWorkspace::forThread();
     cout << "\nMinimum cost from node " << start << " to each node:\n";
     for (int i = 0; i < n; ++i) {
-        cout << "To node " << i << ": cost = " << cost[i] << endl;
+        cout << "To node " << i << ": cost = " << workspace.cost(i) << endl;
     }
 }
 
 int main() {
     int n = 6; // Number of nodes
-    vector<vector<Edge>> graph(n);
+    vector<vector<Edge>> adjacency(n);
 
     // Create weighted graph (directed)
     // Each edge: {destination, cost}
-    graph[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
-    graph[1] = {{0, 2}, {3, 7}, {4, 1}}; // Node 1: to nodes 0,3,4 with respective costs
-    graph[2] = {{0, 4}, {4, 3}};  // Node 2: to nodes 0,4
-    graph[3] = {{1, 7}, {5, 1}};  // Node 3: to nodes 1,5
-    graph[4] = {{1, 1}, {2, 3}, {5, 5}}; // Node 4: to nodes 1,2,5
-    graph[5] = {{3, 1}, {4, 5}};  // Node 5: to nodes 3,4
+    adjacency[0] = {{1, 2}, {2, 4}};  // Node 0: to node 1 (cost=2), to node 2 (cost=4)
+    adjacency[1] = {{0, 2}, {3, 7}, {4, 1}}; // Node 1: to nodes 0,3,4 with respective costs
+    adjacency[2] = {{0, 4}, {4, 3}};  // Node 2: to nodes 0,4
+    adjacency[3] = {{1, 7}, {5, 1}};  // Node 3: to nodes 1,5
+    adjacency[4] = {{1, 1}, {2, 3}, {5, 5}}; // Node 4: to nodes 1,2,5
+    adjacency[5] = {{3, 1}, {4, 5}};  // Node 5: to nodes 3,4
+    CsrGraph graph = CsrGraph::fromAdjacencyList(adjacency);  // Contiguous CSR layout
 
     cout << "Uniform Cost Search starting from node 0:\n";
-    ucs(0, graph);
+    ucs<HeapQueue<int>, PrintVisits>(0, graph);
+    printCosts(0, n);
+
+    // Same search with a radix heap (monotone integer-key queue, common/priority_queues.h)
+    cout << "\nUniform Cost Search with a radix heap:\n";
+    ucs<RadixHeap<int>, PrintVisits>(0, graph);
+    printCosts(0, n);
+
+    // Same search with an indexed 4-ary heap (decrease-key, at most one entry per node)
+    cout << "\nUniform Cost Search with an indexed 4-ary heap:\n";
+    ucs<IndexedHeap<4>, PrintVisits>(0, graph);
+    printCosts(0, n);
 
     return 0;
 }
@@ -100,14 +90,17 @@ int main() {
  * - Similar to Dijkstra's algorithm
  * 
  * Data Structures Used:
- * - Priority Queue: Orders nodes by cost (lowest first)
- * - Vector<bool>: Tracks visited nodes
- * - Vector<int>: Stores minimum cost to reach each node
- * - Adjacency List: Weighted graph representation
+ * - Priority Queue: Orders nodes by cost (lowest first); binary heap by default, indexed 4-ary
+ *   heap with decrease-key, radix heap or Dial's buckets for small integer weights
+ *   (common/priority_queues.h)
+ * - Search Workspace: Epoch-stamped visited flags and minimum costs, reused across calls
+ * - CSR Graph: Contiguous weighted adjacency arrays (common/csr_graph.h)
  * 
  * Complexity Analysis:
  * - Time Complexity: O(E log V) - each edge processed once, log V for priority queue
- * - Space Complexity: O(V) - priority queue size
+ *   (radix heap: O(E + V log C), Dial's buckets: O(E + V + D) with C = max weight, D = max cost)
+ * - Space Complexity: O(V) - visited/cost arrays; the lazy queues hold up to O(E) entries,
+ *   the indexed heap at most V
  * 
  * Advantages:
  * - Guarantees optimal path in weighted graphs